@@ -0,0 +1,385 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Config;
+
+use ArrayIterator;
+use Phalcon\Config;
+use Traversable;
+
+/**
+ * Immutable, precompiled view of a configuration.
+ *
+ * `compile()` merges a configuration (for instance a
+ * `Phalcon\Config\Adapter\Grouped` built from several YAML/INI/JSON files)
+ * once and writes it as a plain PHP array file, together with a flat index of
+ * its leaf paths. `load()` only requires that file, which opcache keeps in
+ * shared memory, so reading the configuration on each request neither parses
+ * the sources nor creates the nested `Phalcon\Config` objects up front:
+ * nested sections are wrapped in read only snapshots when they are accessed,
+ * and `path()` to a leaf is a single hash lookup.
+ *
+ *```php
+ * use Phalcon\Config\Adapter\Grouped;
+ * use Phalcon\Config\Snapshot;
+ *
+ * // deployment
+ * Snapshot::compile(
+ *     new Grouped(
+ *         [
+ *             "config/app.yml",
+ *             "config/app.local.yml",
+ *         ],
+ *         "yaml"
+ *     ),
+ *     "cache/config.php"
+ * );
+ *
+ * // bootstrap
+ * $config = Snapshot::load("cache/config.php");
+ *
+ * echo $config->path("database.host");
+ * echo $config->database->host;
+ *```
+ */
+class Snapshot extends Config
+{
+    /**
+     * Snapshots of the nested sections already accessed
+     *
+     * @var array
+     */
+    protected children = [];
+
+    /**
+     * Leaf paths (top level keys included) of the whole snapshot and their
+     * value
+     *
+     * @var array
+     */
+    protected index = [];
+
+    /**
+     * Lowercase leaf paths and the path they stand for, for case insensitive
+     * lookups
+     *
+     * @var array
+     */
+    protected lowerIndex = [];
+
+    /**
+     * Path of this section in the index, with a trailing delimiter; empty
+     * for the root
+     *
+     * @var string
+     */
+    protected prefix = "";
+
+    /**
+     * Snapshot constructor.
+     *
+     * @param array  $data
+     * @param string $delimiter
+     * @param array  $index      Precomputed index (see compile())
+     * @param array  $lowerIndex Precomputed index (see compile())
+     * @param string $prefix     Path of a nested section in the index
+     */
+    public function __construct(
+        array data = [],
+        string! delimiter = Config::DEFAULT_PATH_DELIMITER,
+        array index = null,
+        array lowerIndex = null,
+        string! prefix = ""
+    ) {
+        var key, value;
+
+        let this->data          = data,
+            this->pathDelimiter = delimiter,
+            this->prefix        = prefix;
+
+        for key, value in data {
+            let this->lowerKeys[mb_strtolower((string) key)] = key;
+        }
+
+        if null === index || null === lowerIndex {
+            let index      = self::buildIndex(data, prefix, delimiter),
+                lowerIndex = self::buildLowerIndex(index);
+        }
+
+        let this->index      = index,
+            this->lowerIndex = lowerIndex;
+    }
+
+    /**
+     * Snapshots are read only
+     */
+    public function clear() -> void
+    {
+        throw new Exception("The configuration snapshot is read only");
+    }
+
+    /**
+     * Merges a configuration and writes it, with its path index, to a PHP
+     * file that `load()` can read back
+     *
+     * @param Config|array $config
+     */
+    public static function compile(var config, string! filePath, string! delimiter = Config::DEFAULT_PATH_DELIMITER) -> <Snapshot>
+    {
+        var data, index, lowerIndex, temporary;
+
+        if typeof config === "object" && config instanceof Config {
+            let data = config->toArray();
+        } elseif typeof config === "array" {
+            let data = config;
+        } else {
+            throw new Exception("Invalid data type for the snapshot.");
+        }
+
+        let index      = self::buildIndex(data, "", delimiter),
+            lowerIndex = self::buildLowerIndex(index);
+
+        /**
+         * Write to a temporary file first so that concurrent requests never
+         * read a partial file
+         */
+        let temporary = filePath . "." . uniqid("", true);
+
+        if unlikely false === file_put_contents(
+            temporary,
+            "<?php\n\nreturn " . var_export(
+                [
+                    "data"       : data,
+                    "delimiter"  : delimiter,
+                    "index"      : index,
+                    "lowerIndex" : lowerIndex
+                ],
+                true
+            ) . ";\n"
+        ) {
+            throw new Exception(
+                "The configuration snapshot could not be written to '" . filePath . "'"
+            );
+        }
+
+        rename(temporary, filePath);
+
+        return new Snapshot(data, delimiter, index, lowerIndex);
+    }
+
+    /**
+     * Returns a top level value, case insensitively. Nested sections are
+     * returned as read only snapshots, like `Phalcon\Config` returns nested
+     * `Config` objects; use `path()` for dotted paths.
+     */
+    public function get(string element, var defaultValue = null, string! cast = null) -> var
+    {
+        var key, value;
+
+        if unlikely !fetch key, this->lowerKeys[mb_strtolower(element)] {
+            return defaultValue;
+        }
+
+        let value = this->data[key];
+
+        if typeof value === "array" {
+            if !fetch value, this->children[key] {
+                let value = new Snapshot(
+                    this->data[key],
+                    this->pathDelimiter,
+                    this->index,
+                    this->lowerIndex,
+                    this->prefix . key . this->pathDelimiter
+                );
+
+                let this->children[key] = value;
+            }
+        }
+
+        if unlikely cast {
+            settype(value, cast);
+        }
+
+        return value;
+    }
+
+    /**
+     * Returns the iterator of the class, with the nested sections as
+     * snapshots
+     */
+    public function getIterator() -> <Traversable>
+    {
+        return new ArrayIterator(
+            this->getSections()
+        );
+    }
+
+    /**
+     * Returns the top level values, with the nested sections as snapshots
+     */
+    public function getValues() -> array
+    {
+        return array_values(
+            this->getSections()
+        );
+    }
+
+    /**
+     * Reads a snapshot written by `compile()`
+     */
+    public static function load(string! filePath) -> <Snapshot>
+    {
+        var compiled;
+
+        let compiled = require filePath;
+
+        if unlikely (typeof compiled !== "array" || !isset compiled["data"] || !isset compiled["index"]) {
+            throw new Exception(
+                "The file '" . filePath . "' is not a configuration snapshot"
+            );
+        }
+
+        return new Snapshot(
+            compiled["data"],
+            compiled["delimiter"],
+            compiled["index"],
+            compiled["lowerIndex"]
+        );
+    }
+
+    /**
+     * Snapshots are read only
+     */
+    public function merge(var toMerge) -> <Config>
+    {
+        throw new Exception("The configuration snapshot is read only");
+    }
+
+    /**
+     * Returns a value using a dotted path. Leaf paths are a single hash
+     * lookup, with a fallback to the lowercase index; paths to sections are
+     * resolved like `Phalcon\Config::path()`.
+     *
+     *```php
+     * echo $config->path("database.host", "localhost");
+     *```
+     */
+    public function path(string path, defaultValue = null, var delimiter = null)
+    {
+        var exact, full, value;
+
+        if empty delimiter || delimiter === this->pathDelimiter {
+            let full = this->prefix . path;
+
+            if likely fetch value, this->index[full] {
+                return value;
+            }
+
+            /**
+             * null values
+             */
+            if array_key_exists(full, this->index) {
+                return null;
+            }
+
+            if fetch exact, this->lowerIndex[mb_strtolower(full)] {
+                return this->index[exact];
+            }
+        }
+
+        return parent::path(path, defaultValue, delimiter);
+    }
+
+    /**
+     * Snapshots are read only
+     */
+    public function remove(string element) -> void
+    {
+        throw new Exception("The configuration snapshot is read only");
+    }
+
+    /**
+     * Returns the configuration as an array
+     */
+    public function toArray() -> array
+    {
+        return this->data;
+    }
+
+    /**
+     * Snapshots are read only
+     */
+    protected function setData(var element, var value) -> void
+    {
+        throw new Exception("The configuration snapshot is read only");
+    }
+
+    /**
+     * Indexes the leaf paths of the data. Sections are not indexed, so each
+     * value is stored once whatever its depth.
+     */
+    private static function buildIndex(array data, string prefix, string delimiter) -> array
+    {
+        var key, nested, nestedPath, nestedValue, path, value;
+        array index;
+
+        let index = [];
+
+        for key, value in data {
+            let path = prefix . key;
+
+            if typeof value === "array" {
+                let nested = self::buildIndex(value, path . delimiter, delimiter);
+
+                for nestedPath, nestedValue in nested {
+                    let index[nestedPath] = nestedValue;
+                }
+            } else {
+                let index[path] = value;
+            }
+        }
+
+        return index;
+    }
+
+    /**
+     * Maps the lowercase version of every path to the path itself
+     */
+    private static function buildLowerIndex(array index) -> array
+    {
+        var path, value;
+        array lowerIndex;
+
+        let lowerIndex = [];
+
+        for path, value in index {
+            let lowerIndex[mb_strtolower(path)] = path;
+        }
+
+        return lowerIndex;
+    }
+
+    /**
+     * Returns the top level values, with the nested sections as snapshots
+     */
+    private function getSections() -> array
+    {
+        var key;
+        array sections;
+
+        let sections = [];
+
+        for key, _ in this->data {
+            let sections[key] = this->get((string) key);
+        }
+
+        return sections;
+    }
+}
@@ -13,6 +13,8 @@ namespace Phalcon;
 use Phalcon\Crypt\CryptInterface;
 use Phalcon\Crypt\Exception;
 use Phalcon\Crypt\Mismatch;
+use Phalcon\Http\Message\Stream;
+use Psr\Http\Message\StreamInterface;
 
 /**
  * Provides encryption capabilities to Phalcon applications.
@@ -42,6 +44,16 @@ class Crypt implements CryptInterface
     const PADDING_SPACE          = 6;
     const PADDING_ZERO           = 5;
 
+    /**
+     * Format of the stream API (encryptStream/decryptStream)
+     */
+    const STREAM_CHUNK_SIZE     = 65536;
+    const STREAM_CIPHER         = "aes-256-gcm";
+    const STREAM_MAGIC          = "PHCS";
+    const STREAM_MAX_CHUNK_SIZE = 16777216;
+    const STREAM_TAG_LENGTH     = 16;
+    const STREAM_VERSION        = 1;
+
     /**
      * @var string
      */
@@ -238,6 +250,50 @@ class Crypt implements CryptInterface
         );
     }
 
+    /**
+     * Decrypts a stream produced by `encryptStream()` chunk by chunk, writing
+     * the plain text to the destination. Each chunk is authenticated before
+     * it is written; a tampered, reordered or truncated stream throws a
+     * `Mismatch` exception. Returns the number of bytes written.
+     *
+     * The source and destination can be file names, stream resources or
+     * `Psr\Http\Message\StreamInterface` objects.
+     *
+     * ```php
+     * $crypt->decryptStream("/tmp/export.csv.enc", "/tmp/export.csv");
+     * ```
+     */
+    public function decryptStream(var source, var destination, string! key = null) -> int
+    {
+        var input, output, decryptKey, e;
+        int total;
+
+        if likely empty key {
+            let decryptKey = this->key;
+        } else {
+            let decryptKey = key;
+        }
+
+        if unlikely empty decryptKey {
+            throw new Exception("Decryption key cannot be empty");
+        }
+
+        let input  = this->getStream(source, "rb"),
+            output = this->getStream(destination, "wb");
+
+        try {
+            let total = this->decryptStreamChunks(input, output, decryptKey);
+        } catch \Throwable, e {
+            this->releaseStreams(source, input, destination, output);
+
+            throw e;
+        }
+
+        this->releaseStreams(source, input, destination, output);
+
+        return total;
+    }
+
     /**
      * Encrypts a text.
      *
@@ -363,6 +419,113 @@ class Crypt implements CryptInterface
         );
     }
 
+    /**
+     * Encrypts a stream in fixed size chunks, writing the result to the
+     * destination, so that memory use does not depend on the size of the
+     * data. Returns the number of bytes written.
+     *
+     * Chunks are encrypted with AES-256-GCM using a key derived (HKDF) from
+     * the encryption key and a random salt. The chunk counter and an end of
+     * stream flag are part of the nonce and the authenticated data, so chunks
+     * cannot be reordered, dropped or truncated without `decryptStream()`
+     * noticing. The cipher, padding and signing settings of the instance are
+     * not used.
+     *
+     * The source and destination can be file names, stream resources or
+     * `Psr\Http\Message\StreamInterface` objects.
+     *
+     * ```php
+     * $crypt->encryptStream("/tmp/export.csv", "/tmp/export.csv.enc");
+     * ```
+     */
+    public function encryptStream(var source, var destination, string! key = null, int chunkSize = self::STREAM_CHUNK_SIZE) -> int
+    {
+        var chunk, encryptKey, input, output, flag, header, next, nonce, prefix, salt,
+            streamKey, tag, encrypted, e;
+        int counter = 0, total = 0;
+
+        if likely empty key {
+            let encryptKey = this->key;
+        } else {
+            let encryptKey = key;
+        }
+
+        if unlikely empty encryptKey {
+            throw new Exception("Encryption key cannot be empty");
+        }
+
+        if unlikely (chunkSize < 1 || chunkSize > self::STREAM_MAX_CHUNK_SIZE) {
+            throw new Exception(
+                "The chunk size must be between 1 and " . self::STREAM_MAX_CHUNK_SIZE . " bytes"
+            );
+        }
+
+        let input  = this->getStream(source, "rb"),
+            output = this->getStream(destination, "wb");
+
+        try {
+            let salt      = openssl_random_pseudo_bytes(16),
+                prefix    = openssl_random_pseudo_bytes(4),
+                streamKey = this->getStreamKey(encryptKey, salt),
+                header    = self::STREAM_MAGIC .
+                            pack("CN", self::STREAM_VERSION, chunkSize) .
+                            salt .
+                            prefix;
+
+            let total = output->write(header),
+                chunk = this->readStreamBytes(input, chunkSize);
+
+            loop {
+                /**
+                 * Read ahead to know whether this is the last chunk
+                 */
+                let next = "";
+
+                if !input->eof() {
+                    let next = this->readStreamBytes(input, chunkSize);
+                }
+
+                let flag  = "" === next ? 1 : 0,
+                    nonce = prefix . pack("NN", 0, counter),
+                    tag   = null;
+
+                let encrypted = openssl_encrypt(
+                    chunk,
+                    self::STREAM_CIPHER,
+                    streamKey,
+                    OPENSSL_RAW_DATA,
+                    nonce,
+                    tag,
+                    header . pack("N", counter) . chr(flag),
+                    self::STREAM_TAG_LENGTH
+                );
+
+                if unlikely false === encrypted {
+                    throw new Exception("Could not encrypt the stream");
+                }
+
+                let total += output->write(
+                    pack("CN", flag, strlen(encrypted)) . encrypted . tag
+                );
+
+                if 1 === flag {
+                    break;
+                }
+
+                let chunk = next,
+                    counter++;
+            }
+        } catch \Throwable, e {
+            this->releaseStreams(source, input, destination, output);
+
+            throw e;
+        }
+
+        this->releaseStreams(source, input, destination, output);
+
+        return total;
+    }
+
     /**
      * Returns a list of available ciphers.
      */
@@ -575,6 +738,166 @@ class Crypt implements CryptInterface
         return openssl_cipher_iv_length(cipher);
     }
 
+    /**
+     * Returns the key used to encrypt a stream, derived from the encryption
+     * key and the salt of the stream
+     */
+    protected function getStreamKey(string! key, string! salt) -> string
+    {
+        return hash_hkdf("sha256", key, 32, "phalcon-crypt-stream", salt);
+    }
+
+    /**
+     * Wraps a file name or a resource in a stream
+     */
+    protected function getStream(var stream, string! mode) -> <StreamInterface>
+    {
+        if typeof stream === "object" && stream instanceof StreamInterface {
+            return stream;
+        }
+
+        return new Stream(stream, mode);
+    }
+
+    /**
+     * Reads the header and the authenticated chunks of an encrypted stream,
+     * writing the plain text to the output
+     */
+    protected function decryptStreamChunks(<StreamInterface> input, <StreamInterface> output, string decryptKey) -> int
+    {
+        var chunkSize, ciphertext, flag, frame, header, length, nonce, plain,
+            prefix, salt, streamKey, tag, unpacked;
+        int counter = 0, total = 0;
+
+        /**
+         * magic (4) | version (1) | chunk size (4) | salt (16) | nonce (4)
+         */
+        let header = this->readStreamBytes(input, 29);
+
+        if unlikely (strlen(header) !== 29 || substr(header, 0, 4) !== self::STREAM_MAGIC) {
+            throw new Mismatch("The stream has not been encrypted with encryptStream()");
+        }
+
+        let unpacked = unpack("Cversion/NchunkSize", substr(header, 4, 5));
+
+        if unlikely unpacked["version"] !== self::STREAM_VERSION {
+            throw new Mismatch("Unsupported encrypted stream version");
+        }
+
+        let chunkSize = unpacked["chunkSize"];
+
+        /**
+         * The header is not authenticated yet: a forged chunk size must not
+         * make the reads below allocate more than a chunk can hold
+         */
+        if unlikely (chunkSize < 1 || chunkSize > self::STREAM_MAX_CHUNK_SIZE) {
+            throw new Mismatch("Invalid chunk size in the encrypted stream");
+        }
+
+        let salt      = substr(header, 9, 16),
+            prefix    = substr(header, 25, 4),
+            streamKey = this->getStreamKey(decryptKey, salt);
+
+        loop {
+            /**
+             * flag (1) | length (4) | ciphertext | tag (16)
+             */
+            let frame = this->readStreamBytes(input, 5);
+
+            if unlikely strlen(frame) !== 5 {
+                throw new Mismatch("Unexpected end of the encrypted stream");
+            }
+
+            let unpacked = unpack("Cflag/Nlength", frame),
+                flag     = unpacked["flag"],
+                length   = unpacked["length"];
+
+            if unlikely (length > chunkSize || flag > 1) {
+                throw new Mismatch("Hash does not match.");
+            }
+
+            let ciphertext = this->readStreamBytes(input, length),
+                tag        = this->readStreamBytes(input, self::STREAM_TAG_LENGTH);
+
+            if unlikely (strlen(ciphertext) !== length || strlen(tag) !== self::STREAM_TAG_LENGTH) {
+                throw new Mismatch("Unexpected end of the encrypted stream");
+            }
+
+            let nonce = prefix . pack("NN", 0, counter),
+                plain = openssl_decrypt(
+                    ciphertext,
+                    self::STREAM_CIPHER,
+                    streamKey,
+                    OPENSSL_RAW_DATA,
+                    nonce,
+                    tag,
+                    header . pack("N", counter) . chr(flag)
+                );
+
+            if unlikely false === plain {
+                throw new Mismatch("Hash does not match.");
+            }
+
+            if "" !== plain {
+                let total += output->write(plain);
+            }
+
+            let counter++;
+
+            if 1 === flag {
+                break;
+            }
+        }
+
+        if unlikely "" !== this->readStreamBytes(input, 1) {
+            throw new Mismatch("Unexpected data after the end of the encrypted stream");
+        }
+
+        return total;
+    }
+
+    /**
+     * Reads exactly `length` bytes from the stream, unless the end of it is
+     * reached first
+     */
+    protected function readStreamBytes(<StreamInterface> stream, int length) -> string
+    {
+        var chunk, data;
+
+        let data = "";
+
+        while strlen(data) < length && !stream->eof() {
+            let chunk = stream->read(length - strlen(data));
+
+            if "" === chunk {
+                break;
+            }
+
+            let data .= chunk;
+        }
+
+        return data;
+    }
+
+    /**
+     * Detaches the streams wrapped around resources passed by the caller, so
+     * that they are not closed, and closes the ones opened from file names
+     */
+    protected function releaseStreams(var source, <StreamInterface> input, var destination, <StreamInterface> output) -> void
+    {
+        if typeof source === "resource" {
+            input->detach();
+        } elseif typeof source === "string" {
+            input->close();
+        }
+
+        if typeof destination === "resource" {
+            output->detach();
+        } elseif typeof destination === "string" {
+            output->close();
+        }
+    }
+
     /**
      * Initialize available cipher algorithms.
      */
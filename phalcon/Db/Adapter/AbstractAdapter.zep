@@ -16,6 +16,7 @@ use Phalcon\Db\Enum;
 use Phalcon\Db\Exception;
 use Phalcon\Db\Index;
 use Phalcon\Db\IndexInterface;
+use Phalcon\Db\Profiler;
 use Phalcon\Db\Reference;
 use Phalcon\Db\ReferenceInterface;
 use Phalcon\Db\RawValue;
@@ -63,6 +64,13 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
      */
     protected eventsManager;
 
+    /**
+     * Profiler called directly for each statement
+     *
+     * @var Profiler|null
+     */
+    protected profiler = null;
+
     /**
      * Active SQL Bind Types
      *
@@ -710,6 +718,14 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->eventsManager;
     }
 
+    /**
+     * Returns the profiler called for each statement
+     */
+    public function getProfiler() -> <Profiler> | null
+    {
+        return this->profiler;
+    }
+
     /**
      * Returns the savepoint name to use for nested transactions
      */
@@ -759,9 +775,7 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
      */
     public function insert(string table, array! values, var fields = null, var dataTypes = null) -> bool
     {
-        var bindDataTypes, bindType, escapedTable, escapedFields, field,
-            insertSql, insertValues, joinedValues, placeholders, position,
-            tableName, value;
+        var bindDataTypes, insertSql, insertValues, statement;
 
         /**
          * A valid array with more than one element is required
@@ -772,65 +786,10 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
             );
         }
 
-        let placeholders  = [],
-            insertValues  = [],
-            bindDataTypes = [];
-
-        /**
-         * Objects are casted using __toString, null values are converted to
-         * string "null", everything else is passed as "?"
-         */
-        for position, value in values {
-            if typeof value == "object" && value instanceof RawValue {
-                let placeholders[] = (string) value;
-            } else {
-                if typeof value == "object" {
-                    let value = (string) value;
-                }
-
-                if value === null {
-                    let placeholders[] = "null";
-                } else {
-                    let placeholders[] = "?";
-                    let insertValues[] = value;
-
-                    if typeof dataTypes == "array" {
-                        if unlikely !fetch bindType, dataTypes[position] {
-                            throw new Exception(
-                                "Incomplete number of bind types"
-                            );
-                        }
-
-                        let bindDataTypes[] = bindType;
-                    }
-                }
-            }
-        }
-
-        if strpos(table, ".") > 0 {
-            let tableName = explode(".", table);
-        } else {
-            let tableName = table;
-        }
-
-        let escapedTable = this->escapeIdentifier(tableName);
-
-        /**
-         * Build the final SQL INSERT statement
-         */
-        let joinedValues = join(", ", placeholders);
-
-        if typeof fields == "array" {
-            let escapedFields = [];
-
-            for field in fields {
-                let escapedFields[] = this->escapeIdentifier(field);
-            }
-
-            let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES (" . joinedValues . ")";
-        } else {
-            let insertSql = "INSERT INTO " . escapedTable . " VALUES (" . joinedValues . ")";
-        }
+        let statement     = this->prepareInsert(table, values, fields, dataTypes),
+            insertSql     = statement[0],
+            insertValues  = statement[1],
+            bindDataTypes = statement[2];
 
         /**
          * Perform the execution via PDO::execute
@@ -876,6 +835,25 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->insert(table, values, fields, dataTypes);
     }
 
+    /**
+     * Checks whether a SELECT locks the rows it reads (`FOR UPDATE`,
+     * `FOR SHARE`, `FOR NO KEY UPDATE`, `FOR KEY SHARE` or
+     * `LOCK IN SHARE MODE`), so that it must run on the primary
+     *
+     * ```php
+     * var_dump(
+     *     AbstractAdapter::isLockingRead("SELECT * FROM robots FOR UPDATE")
+     * );
+     * ```
+     */
+    public static function isLockingRead(string sqlStatement) -> bool
+    {
+        return preg_match(
+            "/\\bFOR\\s+(NO\\s+KEY\\s+)?(UPDATE|SHARE|KEY\\s+SHARE)\\b|\\bLOCK\\s+IN\\s+SHARE\\s+MODE\\b/i",
+            sqlStatement
+        ) === 1;
+    }
+
     /**
      * Returns if nested transactions should use savepoints
      */
@@ -965,6 +943,45 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         );
     }
 
+    /**
+     * Runs several SELECT statements, each one given as
+     * `[sqlStatement, bindParams, bindTypes]`, returning their results with
+     * the same keys. Adapters that support parallel queries (see
+     * `supportsParallelQueries()`) send them at once on separate connections,
+     * so that the total time is the time of the slowest statement; otherwise
+     * they run one after the other.
+     *
+     *```php
+     * $results = $connection->queryParallel(
+     *     [
+     *         "robots" => ["SELECT * FROM robots"],
+     *         "parts"  => ["SELECT * FROM parts WHERE id > :id", ["id" => 10]],
+     *     ]
+     * );
+     *```
+     */
+    public function queryParallel(array statements) -> array
+    {
+        var index, statement, bindParams, bindTypes;
+        array results;
+
+        let results = [];
+
+        for index, statement in statements {
+            if !fetch bindParams, statement[1] {
+                let bindParams = null;
+            }
+
+            if !fetch bindTypes, statement[2] {
+                let bindTypes = null;
+            }
+
+            let results[index] = this->{"query"}(statement[0], bindParams, bindTypes);
+        }
+
+        return results;
+    }
+
     /**
      * Releases given savepoint
      */
@@ -1025,6 +1042,27 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         let this->dialect = dialect;
     }
 
+    /**
+     * Sets a profiler that is called for each statement, without going
+     * through the events manager. Null removes it.
+     *
+     *```php
+     * $connection->setProfiler(
+     *     new \Phalcon\Db\Profiler(
+     *         [
+     *             "aggregate" => true,
+     *         ]
+     *     )
+     * );
+     *```
+     */
+    public function setProfiler(<Profiler> profiler = null) -> <AdapterInterface>
+    {
+        let this->profiler = profiler;
+
+        return this;
+    }
+
     /**
      * Set if nested transactions should use savepoints
      */
@@ -1055,6 +1093,15 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->dialect->sharedLock(sqlQuery);
     }
 
+    /**
+     * Check whether the adapter sends the statements of `queryParallel()` at
+     * once
+     */
+    public function supportsParallelQueries() -> bool
+    {
+        return false;
+    }
+
     /**
      * Check whether the database system requires a sequence to produce
      * auto-numeric values
@@ -1286,6 +1333,61 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->update(table, fields, values, whereCondition, dataTypes);
     }
 
+    /**
+     * Inserts a row or, when a row with the same `conflictFields` (primary
+     * or unique key) exists, updates the other fields of that row, in a
+     * single statement
+     *
+     * ```php
+     * $success = $connection->upsert(
+     *     "robots",
+     *     [1, "Astro Boy", 1952],
+     *     ["id", "name", "year"],
+     *     ["id"]
+     * );
+     *
+     * // Next SQL sentence is sent to the database system (MySQL)
+     * INSERT INTO `robots` (`id`, `name`, `year`) VALUES (1, "Astro boy", 1952)
+     *     ON DUPLICATE KEY UPDATE `name` = VALUES(`name`), `year` = VALUES(`year`);
+     * ```
+     */
+    public function upsert(string table, array! values, array! fields, array! conflictFields, var dataTypes = null) -> bool
+    {
+        var bindDataTypes, field, insertSql, insertValues, statement;
+        array updateFields;
+
+        if unlikely !count(values) {
+            throw new Exception(
+                "Unable to insert into " . table . " without data"
+            );
+        }
+
+        if unlikely !count(conflictFields) {
+            throw new Exception(
+                "The conflict fields are required to upsert into " . table
+            );
+        }
+
+        let updateFields = [];
+
+        for field in fields {
+            if !in_array(field, conflictFields, true) {
+                let updateFields[] = field;
+            }
+        }
+
+        let statement     = this->prepareInsert(table, values, fields, dataTypes),
+            insertSql     = this->dialect->upsert(statement[0], conflictFields, updateFields),
+            insertValues  = statement[1],
+            bindDataTypes = statement[2];
+
+        if !count(bindDataTypes) {
+            return this->{"execute"}(insertSql, insertValues);
+        }
+
+        return this->{"execute"}(insertSql, insertValues, bindDataTypes);
+    }
+
     /**
      * Check whether the database system requires an explicit value for identity
      * columns
@@ -1308,4 +1410,77 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
     {
         return this->fetchOne(this->dialect->viewExists(viewName, schemaName), Enum::FETCH_NUM)[0] > 0;
     }
+
+    /**
+     * Builds an INSERT statement, returning the SQL, the values to bind and
+     * their bind types
+     */
+    protected function prepareInsert(string table, array values, var fields, var dataTypes) -> array
+    {
+        var bindDataTypes, bindType, escapedTable, escapedFields, field,
+            insertSql, insertValues, joinedValues, placeholders, position,
+            tableName, value;
+
+        let placeholders  = [],
+            insertValues  = [],
+            bindDataTypes = [];
+
+        /**
+         * Objects are casted using __toString, null values are converted to
+         * string "null", everything else is passed as "?"
+         */
+        for position, value in values {
+            if typeof value == "object" && value instanceof RawValue {
+                let placeholders[] = (string) value;
+            } else {
+                if typeof value == "object" {
+                    let value = (string) value;
+                }
+
+                if value === null {
+                    let placeholders[] = "null";
+                } else {
+                    let placeholders[] = "?";
+                    let insertValues[] = value;
+
+                    if typeof dataTypes == "array" {
+                        if unlikely !fetch bindType, dataTypes[position] {
+                            throw new Exception(
+                                "Incomplete number of bind types"
+                            );
+                        }
+
+                        let bindDataTypes[] = bindType;
+                    }
+                }
+            }
+        }
+
+        if strpos(table, ".") > 0 {
+            let tableName = explode(".", table);
+        } else {
+            let tableName = table;
+        }
+
+        let escapedTable = this->escapeIdentifier(tableName);
+
+        /**
+         * Build the final SQL INSERT statement
+         */
+        let joinedValues = join(", ", placeholders);
+
+        if typeof fields == "array" {
+            let escapedFields = [];
+
+            for field in fields {
+                let escapedFields[] = this->escapeIdentifier(field);
+            }
+
+            let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES (" . joinedValues . ")";
+        } else {
+            let insertSql = "INSERT INTO " . escapedTable . " VALUES (" . joinedValues . ")";
+        }
+
+        return [insertSql, insertValues, bindDataTypes];
+    }
 }
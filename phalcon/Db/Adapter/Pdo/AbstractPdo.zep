@@ -42,6 +42,38 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     protected affectedRows;
 
+    /**
+     * Connections shared by the adapters of the process with the same DSN,
+     * credentials and options
+     *
+     * @var array
+     */
+    protected static connectionPool = [];
+
+    /**
+     * @var array
+     */
+    protected static connectionStats = [
+        "connects"   : 0,
+        "pings"      : 0,
+        "reconnects" : 0,
+        "reuses"     : 0
+    ];
+
+    /**
+     * Time each pooled connection was last used
+     *
+     * @var array
+     */
+    protected static connectionUsedAt = [];
+
+    /**
+     * Time the connection was last used
+     *
+     * @var float
+     */
+    protected lastUsedAt = 0;
+
     /**
      * PDO Handler
      *
@@ -49,6 +81,28 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     protected pdo;
 
+    /**
+     * Seconds a connection can be idle before it is pinged, 0 to never ping
+     *
+     * @var float
+     */
+    protected pingInterval = 0;
+
+    /**
+     * Key of the connection in the pool, if pooled
+     *
+     * @var string|null
+     */
+    protected poolKey = null;
+
+    /**
+     * Whether reads failing on a lost connection are retried once on a new
+     * connection
+     *
+     * @var bool
+     */
+    protected retryOnDisconnect = false;
+
     /**
      * Constructor for Phalcon\Db\Adapter\Pdo
      *
@@ -61,7 +115,11 @@ abstract class AbstractPdo extends AbstractAdapter
      *     'dialectClass' => null,
      *     'options' => [],
      *     'dsn' => null,
-     *     'charset' => 'utf8mb4'
+     *     'charset' => 'utf8mb4',
+     *     'persistent' => false,
+     *     'pooled' => false,
+     *     'pingInterval' => 0,
+     *     'reconnect' => false
      * ]
      */
     public function __construct(array! descriptor)
@@ -95,11 +153,20 @@ abstract class AbstractPdo extends AbstractAdapter
     {
         var pdo, transactionLevel, eventsManager, savepointName;
 
-        let pdo = this->pdo;
-        if typeof pdo != "object" {
+        if typeof this->pdo != "object" {
             return false;
         }
 
+        /**
+         * A connection dropped while idle is replaced before the
+         * transaction starts on it
+         */
+        if this->transactionLevel == 0 {
+            this->checkConnection();
+        }
+
+        let pdo = this->pdo;
+
         /**
          * Increase the transaction nesting level
          */
@@ -222,6 +289,16 @@ abstract class AbstractPdo extends AbstractAdapter
         return true;
     }
 
+    /**
+     * Closes the connections kept in the pool of the process. The adapters
+     * that use them keep their connection until they are closed.
+     */
+    public static function clearConnectionPool() -> void
+    {
+        let self::connectionPool = [],
+            self::connectionUsedAt = [];
+    }
+
     /**
      * This method is automatically called in \Phalcon\Db\Adapter\Pdo
      * constructor.
@@ -245,16 +322,58 @@ abstract class AbstractPdo extends AbstractAdapter
      * // Reconnect
      * $connection->connect();
      * ```
+     *
+     * Connections can be reused with the following descriptor options:
+     *
+     * - `persistent`: uses a persistent PDO connection, kept by the PHP
+     *   process between requests
+     * - `pooled`: shares the connection with the adapters created in the same
+     *   process with the same DSN, credentials and options (for instance in
+     *   long running CLI workers). A connection in a transaction is not
+     *   shared with new adapters, and one adapter at a time can start a
+     *   transaction on a shared connection (PDO refuses a second one).
+     * - `pingInterval`: seconds a connection can be idle before it is checked
+     *   with a cheap query before its next statement, and reconnected if it
+     *   was dropped
+     * - `reconnect`: retries reads (SELECT, SHOW, DESCRIBE, EXPLAIN) that fail
+     *   because the connection was lost ("server has gone away") once, on a
+     *   new connection, when no transaction is active
      */
     public function connect(array descriptor = null) -> bool
     {
         var username, password, dsnParts, dsnAttributes, dsnAttributesCustomRaw,
-            dsnAttributesMap, options, key, value;
+            dsnAttributesMap, options, key, value, dsn, persistent, pooled,
+            pingInterval, reconnect, pdo, usedAt;
 
         if empty descriptor {
             let descriptor = (array) this->descriptor;
         }
 
+        // Connection management options are not DSN settings
+        if fetch persistent, descriptor["persistent"] {
+            unset descriptor["persistent"];
+        } else {
+            let persistent = false;
+        }
+
+        if fetch pooled, descriptor["pooled"] {
+            unset descriptor["pooled"];
+        } else {
+            let pooled = false;
+        }
+
+        if fetch pingInterval, descriptor["pingInterval"] {
+            let this->pingInterval = (float) pingInterval;
+
+            unset descriptor["pingInterval"];
+        }
+
+        if fetch reconnect, descriptor["reconnect"] {
+            let this->retryOnDisconnect = (bool) reconnect;
+
+            unset descriptor["reconnect"];
+        }
+
         // Check for a username or use null as default
         if fetch username, descriptor["username"] {
             unset descriptor["username"];
@@ -283,6 +402,10 @@ abstract class AbstractPdo extends AbstractAdapter
         // Set PDO to throw exceptions when an error is encountered.
         let options[\PDO::ATTR_ERRMODE] = \PDO::ERRMODE_EXCEPTION;
 
+        if persistent {
+            let options[\PDO::ATTR_PERSISTENT] = true;
+        }
+
         let dsnParts = [];
 
         // Check if the user has defined a custom dsn string. It should be in
@@ -308,16 +431,54 @@ abstract class AbstractPdo extends AbstractAdapter
         }
 
         // Create the dsn attributes string.
-        let dsnAttributes = join(";", dsnParts);
+        let dsnAttributes = join(";", dsnParts),
+            dsn = this->type . ":" . dsnAttributes;
+
+        let this->poolKey = null;
+
+        if pooled {
+            let key = sha1(
+                dsn . chr(0) . username . chr(0) . password . chr(0) . serialize(options)
+            );
+
+            let this->poolKey = key;
+
+            /**
+             * Reuse the connection of the pool; it is pinged before its next
+             * statement if it has been idle for too long
+             */
+            if fetch pdo, self::connectionPool[key] {
+                /**
+                 * The transaction of another adapter would be shared
+                 * without its nesting level
+                 */
+                if typeof pdo == "object" && !pdo->inTransaction() {
+                    let usedAt = self::connectionUsedAt[key],
+                        this->pdo = pdo,
+                        this->lastUsedAt = usedAt,
+                        self::connectionStats["reuses"] = self::connectionStats["reuses"] + 1;
+
+                    return true;
+                }
+            }
+        }
 
         // Create the connection using PDO
         let this->pdo = new \PDO(
-            this->type . ":" . dsnAttributes,
+            dsn,
             username,
             password,
             options
         );
 
+        let this->lastUsedAt = microtime(true),
+            self::connectionStats["connects"] = self::connectionStats["connects"] + 1;
+
+        if pooled {
+            let self::connectionPool[key] = this->pdo,
+                self::connectionUsedAt[key] = this->lastUsedAt;
+        }
+
         return true;
     }
 
@@ -410,7 +571,7 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function execute(string! sqlStatement, var bindParams = null, var bindTypes = null) -> bool
     {
-        var eventsManager, affectedRows, pdo, newStatement, statement;
+        var eventsManager, affectedRows, pdo, newStatement, statement, profiler;
 
         /**
          * Execute the beforeQuery event if an EventsManager is available
@@ -431,6 +592,14 @@ abstract class AbstractPdo extends AbstractAdapter
          */
         let affectedRows = 0;
 
+        this->checkConnection();
+
+        let profiler = this->profiler;
+
+        if profiler !== null {
+            profiler->startQuery(sqlStatement, bindParams, bindTypes);
+        }
+
         let pdo = <\PDO> this->pdo;
 
         if typeof bindParams == "array" {
@@ -455,6 +624,10 @@ abstract class AbstractPdo extends AbstractAdapter
         if typeof affectedRows == "integer" {
             let this->affectedRows = affectedRows;
 
+            if profiler !== null {
+                profiler->stopQuery(affectedRows);
+            }
+
             if typeof eventsManager == "object" {
                 eventsManager->fire("db:afterQuery", this);
             }
@@ -579,6 +752,21 @@ abstract class AbstractPdo extends AbstractAdapter
         return statement;
     }
 
+    /**
+     * Returns the connections made, reused from the pool and made again after
+     * they were lost, the pings of idle connections and the number of pooled
+     * connections of the process
+     */
+    public static function getConnectionStats() -> array
+    {
+        var stats;
+
+        let stats = self::connectionStats,
+            stats["pooled"] = count(array_filter(self::connectionPool));
+
+        return stats;
+    }
+
     /**
      * Return the error info, if any
      */
@@ -710,7 +898,7 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function query(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | bool
     {
-        var eventsManager, pdo, statement, params, types;
+        var eventsManager, statement, params, types, e, profiler;
 
         let eventsManager = <ManagerInterface> this->eventsManager;
 
@@ -727,7 +915,6 @@ abstract class AbstractPdo extends AbstractAdapter
             }
         }
 
-        let pdo = <\PDO> this->pdo;
         if typeof bindParams == "array" {
             let params = bindParams;
             let types = bindTypes;
@@ -736,17 +923,37 @@ abstract class AbstractPdo extends AbstractAdapter
             let types = [];
         }
 
-        let statement = pdo->prepare(sqlStatement);
-        if unlikely typeof statement != "object" {
-            throw new Exception("Cannot prepare statement");
+        this->checkConnection();
+
+        let profiler = this->profiler;
+
+        if profiler !== null {
+            profiler->startQuery(sqlStatement, bindParams, bindTypes);
         }
 
-        let statement = this->executePrepared(statement, params, types);
+        try {
+            let statement = this->runQuery(sqlStatement, params, types);
+        } catch \PDOException, e {
+            /**
+             * Reads are retried once on a new connection
+             */
+            if !this->retryOnDisconnect || this->transactionLevel > 0 || this->isUnderTransaction() || !this->isReadStatement(sqlStatement) || !this->isConnectionLost(e) {
+                throw e;
+            }
+
+            this->reconnect();
+
+            let statement = this->runQuery(sqlStatement, params, types);
+        }
 
         /**
          * Execute the afterQuery event if an EventsManager is available
          */
         if typeof statement == "object" {
+            if profiler !== null {
+                profiler->stopQuery(statement->rowCount());
+            }
+
             if typeof eventsManager == "object" {
                 eventsManager->fire("db:afterQuery", this);
             }
@@ -836,4 +1043,277 @@ abstract class AbstractPdo extends AbstractAdapter
      * Returns PDO adapter DSN defaults as a key-value map.
      */
     abstract protected function getDsnDefaults() -> array;
+
+    /**
+     * Checks whether the descriptor sets PDO attributes that change the
+     * connection (SSL, init commands, timeouts...), which the connections
+     * opened by other drivers for asynchronous queries would not honour
+     */
+    protected function hasConnectionOptions() -> bool
+    {
+        var attribute, options, value;
+
+        if !fetch options, this->descriptor["options"] {
+            return false;
+        }
+
+        if typeof options != "array" {
+            return false;
+        }
+
+        for attribute, value in options {
+            if attribute != \PDO::ATTR_ERRMODE && attribute != \PDO::ATTR_PERSISTENT && attribute != \PDO::ATTR_EMULATE_PREPARES && attribute != \PDO::ATTR_DEFAULT_FETCH_MODE {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Replaces the named placeholders of a statement with the quoted values,
+     * for drivers that cannot bind parameters (asynchronous queries). Quoted
+     * strings and identifiers are left untouched, so that `'a:id'` is not
+     * taken for the placeholder `:id`.
+     */
+    protected function interpolate(string sqlStatement, var bindParams, var bindTypes) -> string
+    {
+        var wildcard, value, type, position, itemValue, parts, part, number;
+        array replacements;
+        string statement;
+
+        if typeof bindParams != "array" || empty bindParams {
+            return sqlStatement;
+        }
+
+        let replacements = [];
+
+        for wildcard, value in bindParams {
+            if unlikely typeof wildcard != "string" {
+                throw new Exception(
+                    "Positional placeholders cannot be interpolated"
+                );
+            }
+
+            let type = Column::BIND_SKIP;
+
+            if typeof bindTypes == "array" {
+                if !fetch type, bindTypes[wildcard] {
+                    let type = Column::BIND_SKIP;
+                }
+            }
+
+            if strpos(wildcard, ":") !== 0 {
+                let wildcard = ":" . wildcard;
+            }
+
+            if typeof value == "array" {
+                for position, itemValue in value {
+                    let replacements[wildcard . position] = this->quoteValue(itemValue, type);
+                }
+            } else {
+                let replacements[wildcard] = this->quoteValue(value, type);
+            }
+        }
+
+        /**
+         * The quoted literals are captured at the odd positions
+         */
+        let parts = preg_split(
+            "/('(?:[^'\\\\]|\\\\.|'')*'|\"(?:[^\"\\\\]|\\\\.|\"\")*\"|`[^`]*`)/s",
+            sqlStatement,
+            -1,
+            PREG_SPLIT_DELIM_CAPTURE
+        );
+
+        if unlikely typeof parts != "array" {
+            throw new Exception(
+                "The statement could not be interpolated"
+            );
+        }
+
+        let statement = "";
+
+        for number, part in parts {
+            if number % 2 === 1 {
+                let statement .= part;
+
+                continue;
+            }
+
+            /**
+             * strtr() replaces the longest placeholders first
+             */
+            let statement .= strtr(part, replacements);
+        }
+
+        return statement;
+    }
+
+    /**
+     * Checks whether an exception was caused by a lost connection
+     */
+    protected function isConnectionLost(<\PDOException> e) -> bool
+    {
+        var code, errorInfo, message, needle;
+
+        let errorInfo = e->errorInfo;
+
+        if typeof errorInfo == "array" {
+            if fetch code, errorInfo[1] {
+                /**
+                 * MySQL: server has gone away, lost connection during query,
+                 * lost connection at reading
+                 */
+                if in_array(code, [2006, 2013, 2055]) {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * SQLSTATE class 08: connection exception
+         */
+        if strpos((string) e->getCode(), "08") === 0 {
+            return true;
+        }
+
+        let message = e->getMessage();
+
+        for needle in [
+            "server has gone away",
+            "lost connection",
+            "no connection to the server",
+            "server closed the connection unexpectedly",
+            "ssl connection has been closed unexpectedly",
+            "terminating connection",
+            "error while sending"
+        ] {
+            if false !== stripos(message, needle) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Checks the connection with a cheap query
+     */
+    protected function ping() -> bool
+    {
+        var e;
+
+        let self::connectionStats["pings"] = self::connectionStats["pings"] + 1;
+
+        try {
+            this->pdo->query("SELECT 1");
+        } catch \Throwable, e {
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Pings the connection before a statement when it has been idle for more
+     * than `pingInterval` seconds and reconnects if it was dropped. Pooled
+     * connections in a transaction, whichever adapter started it, are never
+     * replaced.
+     */
+    private function checkConnection() -> void
+    {
+        var key, now;
+
+        let now = microtime(true);
+
+        if this->pingInterval > 0 && this->transactionLevel === 0 && typeof this->pdo == "object" && !this->pdo->inTransaction() {
+            if now - this->lastUsedAt > this->pingInterval && !this->ping() {
+                this->reconnect();
+            }
+        }
+
+        let this->lastUsedAt = now,
+            key = this->poolKey;
+
+        if key !== null {
+            let self::connectionUsedAt[key] = now;
+        }
+    }
+
+    /**
+     * Checks whether a statement only reads data and can be sent again
+     */
+    private function isReadStatement(string sqlStatement) -> bool
+    {
+        if !preg_match("/^\\s*(SELECT|SHOW|DESCRIBE|DESC|EXPLAIN)\\b/i", sqlStatement) {
+            return false;
+        }
+
+        return !self::isLockingRead(sqlStatement);
+    }
+
+    /**
+     * Returns a value as a SQL literal
+     */
+    private function quoteValue(var value, var type) -> string
+    {
+        if value === null {
+            return "NULL";
+        }
+
+        if typeof value == "boolean" {
+            return value ? "TRUE" : "FALSE";
+        }
+
+        if type == Column::BIND_PARAM_INT {
+            return (string) intval(value, 10);
+        }
+
+        if typeof value == "integer" || typeof value == "double" {
+            return (string) value;
+        }
+
+        if type == Column::BIND_PARAM_DECIMAL && is_numeric(value) {
+            return (string) value;
+        }
+
+        return this->escapeString((string) value);
+    }
+
+    /**
+     * Replaces a lost connection, also in the pool
+     */
+    private function reconnect() -> void
+    {
+        var key;
+
+        let key = this->poolKey;
+
+        if key !== null {
+            let self::connectionPool[key] = null;
+        }
+
+        let this->pdo = null;
+
+        this->connect();
+
+        let self::connectionStats["reconnects"] = self::connectionStats["reconnects"] + 1;
+    }
+
+    /**
+     * Prepares and executes a statement
+     */
+    private function runQuery(string sqlStatement, array params, var types) -> <\PDOStatement>
+    {
+        var statement;
+
+        let statement = this->pdo->prepare(sqlStatement);
+
+        if unlikely typeof statement != "object" {
+            throw new Exception("Cannot prepare statement");
+        }
+
+        return this->executePrepared(statement, params, types);
+    }
 }
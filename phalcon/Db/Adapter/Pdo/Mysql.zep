@@ -19,6 +19,7 @@ use Phalcon\Db\Index;
 use Phalcon\Db\IndexInterface;
 use Phalcon\Db\Reference;
 use Phalcon\Db\ReferenceInterface;
+use Phalcon\Db\Result\ArrayResult;
 
 /**
  * Specific functions for the Mysql database system
@@ -44,6 +45,13 @@ class Mysql extends PdoAdapter
      */
     protected dialectType = "mysql";
 
+    /**
+     * mysqli connections used by queryParallel()
+     *
+     * @var array
+     */
+    protected parallelConnections = [];
+
     /**
      * @var string
      */
@@ -75,6 +83,23 @@ class Mysql extends PdoAdapter
         );
     }
 
+    /**
+     * Closes the active connection and the mysqli connections opened by
+     * queryParallel()
+     */
+    public function close() -> bool
+    {
+        var link;
+
+        for link in this->parallelConnections {
+            mysqli_close(link);
+        }
+
+        let this->parallelConnections = [];
+
+        return parent::close();
+    }
+
     /**
      * Returns an array of Phalcon\Db\Column objects describing a table
      *
@@ -574,6 +599,107 @@ class Mysql extends PdoAdapter
         return referenceObjects;
     }
 
+    /**
+     * Sends several SELECT statements at once, each on its own mysqli
+     * connection (`MYSQLI_ASYNC`), and waits for all of them. Under a
+     * transaction the statements run on this connection, one after the
+     * other, so that they see its changes.
+     */
+    public function queryParallel(array statements) -> array
+    {
+        var index, statement, bindParams, bindTypes, link, links, result,
+            rows, error, e;
+        array results;
+        int number;
+
+        if count(statements) < 2 || !this->supportsParallelQueries() || this->{"isUnderTransaction"}() {
+            return parent::queryParallel(statements);
+        }
+
+        let links  = [],
+            number = 0;
+
+        try {
+            for index, statement in statements {
+                if !fetch bindParams, statement[1] {
+                    let bindParams = null;
+                }
+
+                if !fetch bindTypes, statement[2] {
+                    let bindTypes = null;
+                }
+
+                let link = this->getParallelConnection(number);
+
+                if unlikely !mysqli_query(link, this->interpolate(statement[0], bindParams, bindTypes), MYSQLI_ASYNC) {
+                    throw new Exception(
+                        mysqli_error(link)
+                    );
+                }
+
+                let links[index] = link,
+                    number++;
+            }
+        } catch \Throwable, e {
+            /**
+             * The connections that already sent a statement still have a
+             * result to reap; they are closed so that the next call does not
+             * get "Commands out of sync"
+             */
+            this->closeParallelConnections(number + 1);
+
+            throw e;
+        }
+
+        /**
+         * Every result is reaped, so that the connections can be used again
+         * even if a statement failed
+         */
+        let results = [],
+            error   = null;
+
+        for index, link in links {
+            try {
+                let result = mysqli_reap_async_query(link);
+            } catch \Throwable, e {
+                let result = false;
+            }
+
+            if result === false {
+                if error === null {
+                    let error = mysqli_error(link);
+                }
+
+                continue;
+            }
+
+            if typeof result == "object" {
+                let rows = mysqli_fetch_all(result, MYSQLI_ASSOC);
+
+                mysqli_free_result(result);
+            } else {
+                let rows = [];
+            }
+
+            let results[index] = new ArrayResult(rows);
+        }
+
+        if unlikely error !== null {
+            throw new Exception(error);
+        }
+
+        return results;
+    }
+
+    /**
+     * Parallel queries need the mysqli extension and a descriptor without a
+     * custom DSN or PDO attributes that change the connection
+     */
+    public function supportsParallelQueries() -> bool
+    {
+        return extension_loaded("mysqli") && !isset this->descriptor["dsn"] && !this->hasConnectionOptions();
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
@@ -584,4 +710,81 @@ class Mysql extends PdoAdapter
             "charset" : "utf8mb4"
         ];
     }
+
+    /**
+     * Closes the first mysqli connections of queryParallel() and forgets
+     * them, so that they are opened again when needed
+     */
+    private function closeParallelConnections(int count) -> void
+    {
+        var link, links, number;
+
+        let links = this->parallelConnections;
+
+        for number, link in links {
+            if number < count {
+                mysqli_close(link);
+
+                unset this->parallelConnections[number];
+            }
+        }
+    }
+
+    /**
+     * Returns the mysqli connection for the n'th statement of
+     * queryParallel(), connecting it with the descriptor of the adapter
+     */
+    private function getParallelConnection(int number) -> var
+    {
+        var descriptor, link, host, port, socket, dbname, username, password,
+            charset;
+
+        if fetch link, this->parallelConnections[number] {
+            return link;
+        }
+
+        let descriptor = this->descriptor;
+
+        if !fetch host, descriptor["host"] {
+            let host = null;
+        }
+
+        if !fetch port, descriptor["port"] {
+            let port = 3306;
+        }
+
+        if !fetch socket, descriptor["unix_socket"] {
+            let socket = null;
+        }
+
+        if !fetch dbname, descriptor["dbname"] {
+            let dbname = null;
+        }
+
+        if !fetch username, descriptor["username"] {
+            let username = null;
+        }
+
+        if !fetch password, descriptor["password"] {
+            let password = null;
+        }
+
+        if !fetch charset, descriptor["charset"] {
+            let charset = "utf8mb4";
+        }
+
+        let link = mysqli_init();
+
+        if unlikely !mysqli_real_connect(link, host, username, password, dbname, (int) port, socket) {
+            throw new Exception(
+                "Cannot connect for parallel queries: " . mysqli_connect_error()
+            );
+        }
+
+        mysqli_set_charset(link, charset);
+
+        let this->parallelConnections[number] = link;
+
+        return link;
+    }
 }
@@ -18,6 +18,7 @@ use Phalcon\Db\Exception;
 use Phalcon\Db\RawValue;
 use Phalcon\Db\Reference;
 use Phalcon\Db\ReferenceInterface;
+use Phalcon\Db\Result\ArrayResult;
 use Throwable;
 
 /**
@@ -44,6 +45,13 @@ class Postgresql extends PdoAdapter
      */
     protected dialectType = "postgresql";
 
+    /**
+     * pgsql connections used by queryParallel()
+     *
+     * @var array
+     */
+    protected parallelConnections = [];
+
     /**
      * @var string
      */
@@ -63,6 +71,23 @@ class Postgresql extends PdoAdapter
         parent::__construct(descriptor);
     }
 
+    /**
+     * Closes the active connection and the pgsql connections opened by
+     * queryParallel()
+     */
+    public function close() -> bool
+    {
+        var link;
+
+        for link in this->parallelConnections {
+            pg_close(link);
+        }
+
+        let this->parallelConnections = [];
+
+        return parent::close();
+    }
+
     /**
      * This method is automatically called in Phalcon\Db\Adapter\Pdo
      * constructor. Call it when you need to restore a database connection.
@@ -659,6 +684,97 @@ class Postgresql extends PdoAdapter
         return true;
     }
 
+    /**
+     * Sends several SELECT statements at once, each on its own pgsql
+     * connection (`pg_send_query()`), and waits for all of them. Under a
+     * transaction the statements run on this connection, one after the
+     * other, so that they see its changes.
+     */
+    public function queryParallel(array statements) -> array
+    {
+        var index, statement, bindParams, bindTypes, link, links, result,
+            rows, error;
+        array results;
+        int number;
+
+        if count(statements) < 2 || !this->supportsParallelQueries() || this->{"isUnderTransaction"}() {
+            return parent::queryParallel(statements);
+        }
+
+        let links  = [],
+            number = 0;
+
+        for index, statement in statements {
+            if !fetch bindParams, statement[1] {
+                let bindParams = null;
+            }
+
+            if !fetch bindTypes, statement[2] {
+                let bindTypes = null;
+            }
+
+            let link = this->getParallelConnection(number);
+
+            pg_send_query(
+                link,
+                this->interpolate(statement[0], bindParams, bindTypes)
+            );
+
+            let links[index] = link,
+                number++;
+        }
+
+        let results = [],
+            error   = null;
+
+        for index, link in links {
+            let result = pg_get_result(link),
+                rows   = [];
+
+            if typeof result != "boolean" {
+                if pg_result_status(result) == PGSQL_FATAL_ERROR {
+                    if error === null {
+                        let error = pg_result_error(result);
+                    }
+                } else {
+                    let rows = pg_fetch_all(result);
+
+                    if typeof rows != "array" {
+                        let rows = [];
+                    } else {
+                        let rows = this->castParallelRows(result, rows);
+                    }
+                }
+            }
+
+            /**
+             * Drain the connection so that it can be used again
+             */
+            loop {
+                if typeof pg_get_result(link) == "boolean" {
+                    break;
+                }
+            }
+
+            let results[index] = new ArrayResult(rows);
+        }
+
+        if unlikely error !== null {
+            throw new Exception(error);
+        }
+
+        return results;
+    }
+
+    /**
+     * Parallel queries need the pgsql extension and a descriptor without a
+     * custom DSN or PDO attributes that change the connection
+     */
+    public function supportsParallelQueries() -> bool
+    {
+        return extension_loaded("pgsql") && !isset this->descriptor["dsn"] && !this->hasConnectionOptions();
+    }
+
     /**
      * Check whether the database system requires a sequence to produce
      * auto-numeric values
@@ -684,4 +800,116 @@ class Postgresql extends PdoAdapter
     {
         return [];
     }
+
+    /**
+     * pgsql returns every value as a string ("t"/"f" for booleans): the
+     * booleans, integers and binary strings are converted as PDO returns
+     * them
+     */
+    private function castParallelRows(var result, array rows) -> array
+    {
+        var field, index, row, type, value;
+        array types;
+        int count, number;
+
+        let types  = [],
+            count  = pg_num_fields(result),
+            number = 0;
+
+        while number < count {
+            let type = pg_field_type(result, number);
+
+            if type === "bool" || type === "int2" || type === "int4" || type === "int8" || type === "oid" || type === "bytea" {
+                let types[pg_field_name(result, number)] = type;
+            }
+
+            let number++;
+        }
+
+        if empty types {
+            return rows;
+        }
+
+        for index, row in rows {
+            for field, type in types {
+                if !fetch value, row[field] {
+                    continue;
+                }
+
+                if value === null {
+                    continue;
+                }
+
+                switch type {
+                    case "bool":
+                        let row[field] = value === "t";
+                        break;
+
+                    case "bytea":
+                        let row[field] = pg_unescape_bytea(value);
+                        break;
+
+                    default:
+                        let row[field] = (int) value;
+                }
+            }
+
+            let rows[index] = row;
+        }
+
+        return rows;
+    }
+
+    /**
+     * Returns the pgsql connection for the n'th statement of
+     * queryParallel(), connecting it with the descriptor of the adapter
+     */
+    private function getParallelConnection(int number) -> var
+    {
+        var descriptor, link, key, value, schema;
+        array parts;
+
+        if fetch link, this->parallelConnections[number] {
+            return link;
+        }
+
+        let descriptor = this->descriptor,
+            parts      = [];
+
+        /**
+         * The other settings of the descriptor are DSN settings (sslmode,
+         * connect_timeout, application_name...), which libpq accepts too
+         */
+        for key, value in descriptor {
+            if typeof key != "string" || in_array(key, ["dialectClass", "options", "persistent", "pingInterval", "pooled", "reconnect", "schema"], true) {
+                continue;
+            }
+
+            if value === null || value === "" || typeof value == "array" || typeof value == "object" {
+                continue;
+            }
+
+            if key === "username" {
+                let key = "user";
+            }
+
+            let parts[] = key . "='" . addcslashes((string) value, "'\\") . "'";
+        }
+
+        let link = pg_connect(join(" ", parts), PGSQL_CONNECT_FORCE_NEW);
+
+        if unlikely typeof link == "boolean" {
+            throw new Exception("Cannot connect for parallel queries");
+        }
+
+        if fetch schema, descriptor["schema"] {
+            if !empty schema {
+                pg_query(link, "SET search_path TO '" . schema . "'");
+            }
+        }
+
+        let this->parallelConnections[number] = link;
+
+        return link;
+    }
 }
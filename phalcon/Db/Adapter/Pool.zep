@@ -0,0 +1,1035 @@
+
+/**
+ * This file is part of the Phalcon.
+ *
+ * (c) Phalcon Team <team@phalcon.com>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Db\Adapter;
+
+use Closure;
+use Phalcon\Db\ColumnInterface;
+use Phalcon\Db\DialectInterface;
+use Phalcon\Db\Enum;
+use Phalcon\Db\Exception;
+use Phalcon\Db\IndexInterface;
+use Phalcon\Db\RawValue;
+use Phalcon\Db\ReferenceInterface;
+use Phalcon\Db\ResultInterface;
+
+/**
+ * Phalcon\Db\Adapter\Pool
+ *
+ * Read/write splitting over a primary connection and a pool of replicas.
+ * SELECT statements are sent to one of the healthy replicas (picked by
+ * weight and kept for the lifetime of the pool), everything else to the
+ * primary. After a write, or while the primary is under a transaction, reads
+ * are sent to the primary too, so that a request always reads its own
+ * writes.
+ *
+ * SELECT statements that lock rows (`FOR UPDATE`, `FOR SHARE`,
+ * `LOCK IN SHARE MODE`...) go to the primary. SELECT statements calling
+ * functions with side effects, such as `nextval()`, `GET_LOCK()` or
+ * `pg_advisory_lock()`, cannot be detected: run them on `getPrimary()`, or
+ * call `setSticky(true)` first.
+ *
+ * Replicas can be given as adapters or as closures that create them, which
+ * are only called when the replica is needed. Replicas that cannot be
+ * connected to, or whose replication lag is above `maxLag`, are ejected and
+ * checked again after `checkInterval` seconds.
+ *
+ *```php
+ * use Phalcon\Db\Adapter\Pdo\Mysql;
+ * use Phalcon\Db\Adapter\Pool;
+ *
+ * $container->setShared(
+ *     "db",
+ *     function () {
+ *         return new Pool(
+ *             new Mysql($primaryConfig),
+ *             [
+ *                 function () {
+ *                     return new Mysql($replica1Config);
+ *                 },
+ *                 [
+ *                     "adapter" => function () {
+ *                         return new Mysql($replica2Config);
+ *                     },
+ *                     "weight"  => 2,
+ *                 ],
+ *             ],
+ *             [
+ *                 "maxLag"        => 5,
+ *                 "checkInterval" => 10,
+ *             ]
+ *         );
+ *     }
+ * );
+ *```
+ */
+class Pool implements AdapterInterface
+{
+    /**
+     * Replicas (adapters or closures that create them)
+     *
+     * @var array
+     */
+    protected adapters = [];
+
+    /**
+     * Time of the last lag check of each replica
+     *
+     * @var array
+     */
+    protected checkedAt = [];
+
+    /**
+     * Seconds between checks of a replica
+     *
+     * @var float
+     */
+    protected checkInterval = 5;
+
+    /**
+     * Time until which each replica is ejected
+     *
+     * @var array
+     */
+    protected ejectedUntil = [];
+
+    /**
+     * Adapter that ran the last statement
+     *
+     * @var AdapterInterface
+     */
+    protected lastAdapter;
+
+    /**
+     * Query returning the replication lag in seconds (first column)
+     *
+     * @var string|null
+     */
+    protected lagQuery = null;
+
+    /**
+     * Last replication lag measured for each replica
+     *
+     * @var array
+     */
+    protected lags = [];
+
+    /**
+     * Maximum replication lag in seconds, 0 to not check the lag
+     *
+     * @var float
+     */
+    protected maxLag = 0;
+
+    /**
+     * @var AdapterInterface
+     */
+    protected primary;
+
+    /**
+     * Index of the replica used for reads
+     *
+     * @var int|null
+     */
+    protected replica = null;
+
+    /**
+     * Whether reads are sent to the primary
+     *
+     * @var bool
+     */
+    protected sticky = false;
+
+    /**
+     * Whether reads are sent to the primary after a write
+     *
+     * @var bool
+     */
+    protected stickyAfterWrite = true;
+
+    /**
+     * @var array
+     */
+    protected weights = [];
+
+    /**
+     * Phalcon\Db\Adapter\Pool constructor
+     *
+     * @param array options = [
+     *     'maxLag' => 0,
+     *     'checkInterval' => 5,
+     *     'lagQuery' => null,
+     *     'sticky' => true
+     * ]
+     */
+    public function __construct(<AdapterInterface> primary, array replicas = [], array options = [])
+    {
+        var adapter, index, option, replica, weight;
+
+        let this->primary     = primary,
+            this->lastAdapter = primary;
+
+        for index, replica in replicas {
+            let weight = 1;
+
+            if typeof replica === "array" {
+                if unlikely !fetch adapter, replica["adapter"] {
+                    throw new Exception(
+                        "The adapter of the replica '" . index . "' is required"
+                    );
+                }
+
+                if fetch option, replica["weight"] {
+                    let weight = (int) option;
+                }
+            } else {
+                let adapter = replica;
+            }
+
+            if unlikely !(adapter instanceof AdapterInterface || adapter instanceof Closure) {
+                throw new Exception(
+                    "The replica '" . index . "' must be an adapter or a closure returning an adapter"
+                );
+            }
+
+            let this->adapters[index]     = adapter,
+                this->weights[index]      = weight,
+                this->checkedAt[index]    = 0,
+                this->ejectedUntil[index] = 0,
+                this->lags[index]         = null;
+        }
+
+        if fetch option, options["maxLag"] {
+            let this->maxLag = (float) option;
+        }
+
+        if fetch option, options["checkInterval"] {
+            let this->checkInterval = (float) option;
+        }
+
+        if fetch option, options["lagQuery"] {
+            let this->lagQuery = option;
+        }
+
+        if fetch option, options["sticky"] {
+            let this->stickyAfterWrite = (bool) option;
+        }
+    }
+
+    /**
+     * Adds a column to a table
+     */
+    public function addColumn(string! tableName, string! schemaName, <ColumnInterface> column) -> bool
+    {
+        return this->getWriteAdapter()->addColumn(tableName, schemaName, column);
+    }
+
+    /**
+     * Adds an index to a table
+     */
+    public function addIndex(string! tableName, string! schemaName, <IndexInterface> index) -> bool
+    {
+        return this->getWriteAdapter()->addIndex(tableName, schemaName, index);
+    }
+
+    /**
+     * Adds a foreign key to a table
+     */
+    public function addForeignKey(string! tableName, string! schemaName, <ReferenceInterface> reference) -> bool
+    {
+        return this->getWriteAdapter()->addForeignKey(tableName, schemaName, reference);
+    }
+
+    /**
+     * Adds a primary key to a table
+     */
+    public function addPrimaryKey(string! tableName, string! schemaName, <IndexInterface> index) -> bool
+    {
+        return this->getWriteAdapter()->addPrimaryKey(tableName, schemaName, index);
+    }
+
+    /**
+     * Returns the number of affected rows by the last statement
+     */
+    public function affectedRows() -> int
+    {
+        return this->lastAdapter->affectedRows();
+    }
+
+    /**
+     * Starts a transaction on the primary
+     */
+    public function begin(bool nesting = true) -> bool
+    {
+        return this->getWriteAdapter()->begin(nesting);
+    }
+
+    /**
+     * Closes the primary and the replicas that have been connected
+     */
+    public function close() -> bool
+    {
+        var adapter;
+
+        for adapter in this->adapters {
+            if adapter instanceof AdapterInterface {
+                adapter->close();
+            }
+        }
+
+        return this->primary->close();
+    }
+
+    /**
+     * Commits the active transaction of the primary
+     */
+    public function commit(bool nesting = true) -> bool
+    {
+        return this->getWriteAdapter()->commit(nesting);
+    }
+
+    /**
+     * Connects the primary
+     */
+    public function connect(array descriptor = null) -> bool
+    {
+        return this->primary->connect(descriptor);
+    }
+
+    /**
+     * Creates a new savepoint
+     */
+    public function createSavepoint(string! name) -> bool
+    {
+        return this->getWriteAdapter()->createSavepoint(name);
+    }
+
+    /**
+     * Creates a table
+     */
+    public function createTable(string! tableName, string! schemaName, array! definition) -> bool
+    {
+        return this->getWriteAdapter()->createTable(tableName, schemaName, definition);
+    }
+
+    /**
+     * Creates a view
+     */
+    public function createView(string! viewName, array! definition, string schemaName = null) -> bool
+    {
+        return this->getWriteAdapter()->createView(viewName, definition, schemaName);
+    }
+
+    /**
+     * Deletes data from a table using custom RDBMS SQL syntax
+     */
+    public function delete(var table, whereCondition = null, placeholders = null, dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->delete(table, whereCondition, placeholders, dataTypes);
+    }
+
+    /**
+     * Returns an array of Phalcon\Db\Column objects describing a table
+     */
+    public function describeColumns(string! table, string schema = null) -> <ColumnInterface[]>
+    {
+        return this->primary->describeColumns(table, schema);
+    }
+
+    /**
+     * Lists table indexes
+     */
+    public function describeIndexes(string! table, string schema = null) -> <IndexInterface[]>
+    {
+        return this->primary->describeIndexes(table, schema);
+    }
+
+    /**
+     * Lists table references
+     */
+    public function describeReferences(string! table, string schema = null) -> <ReferenceInterface[]>
+    {
+        return this->primary->describeReferences(table, schema);
+    }
+
+    /**
+     * Drops a column from a table
+     */
+    public function dropColumn(string! tableName, string! schemaName, string columnName) -> bool
+    {
+        return this->getWriteAdapter()->dropColumn(tableName, schemaName, columnName);
+    }
+
+    /**
+     * Drops a foreign key from a table
+     */
+    public function dropForeignKey(string! tableName, string! schemaName, string referenceName) -> bool
+    {
+        return this->getWriteAdapter()->dropForeignKey(tableName, schemaName, referenceName);
+    }
+
+    /**
+     * Drop an index from a table
+     */
+    public function dropIndex(string! tableName, string! schemaName, string indexName) -> bool
+    {
+        return this->getWriteAdapter()->dropIndex(tableName, schemaName, indexName);
+    }
+
+    /**
+     * Drops primary key from a table
+     */
+    public function dropPrimaryKey(string! tableName, string! schemaName) -> bool
+    {
+        return this->getWriteAdapter()->dropPrimaryKey(tableName, schemaName);
+    }
+
+    /**
+     * Drops a table from a schema/database
+     */
+    public function dropTable(string! tableName, string! schemaName = null, bool ifExists = true) -> bool
+    {
+        return this->getWriteAdapter()->dropTable(tableName, schemaName, ifExists);
+    }
+
+    /**
+     * Drops a view
+     */
+    public function dropView(string! viewName, string! schemaName = null, bool ifExists = true) -> bool
+    {
+        return this->getWriteAdapter()->dropView(viewName, schemaName, ifExists);
+    }
+
+    /**
+     * Escapes a column/table/schema name
+     */
+    public function escapeIdentifier(identifier) -> string
+    {
+        return this->primary->escapeIdentifier(identifier);
+    }
+
+    /**
+     * Escapes a value to avoid SQL injections
+     */
+    public function escapeString(string! str) -> string
+    {
+        return this->primary->escapeString(str);
+    }
+
+    /**
+     * Sends SQL statements that don't return rows to the primary
+     */
+    public function execute(string! sqlStatement, var placeholders = null, var dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->execute(sqlStatement, placeholders, dataTypes);
+    }
+
+    /**
+     * Dumps the complete result of a query into an array
+     */
+    public function fetchAll(string! sqlQuery, var fetchMode = Enum::FETCH_ASSOC, var bindParams = null, var bindTypes = null) -> array
+    {
+        return this->getAdapterFor(sqlQuery)->fetchAll(sqlQuery, fetchMode, bindParams, bindTypes);
+    }
+
+    /**
+     * Returns the n'th field of first row in a SQL query result
+     */
+    public function fetchColumn(string sqlQuery, array placeholders = [], var column = 0) -> string | bool
+    {
+        return this->getAdapterFor(sqlQuery)->fetchColumn(sqlQuery, placeholders, column);
+    }
+
+    /**
+     * Returns the first row in a SQL query result
+     */
+    public function fetchOne(string! sqlQuery, var fetchMode = Enum::FETCH_ASSOC, var bindParams = null, var bindTypes = null) -> array
+    {
+        return this->getAdapterFor(sqlQuery)->fetchOne(sqlQuery, fetchMode, bindParams, bindTypes);
+    }
+
+    /**
+     * Returns a SQL modified with a FOR UPDATE clause
+     */
+    public function forUpdate(string! sqlQuery) -> string
+    {
+        return this->primary->forUpdate(sqlQuery);
+    }
+
+    /**
+     * Returns the SQL column definition from a column
+     */
+    public function getColumnDefinition(<ColumnInterface> column) -> string
+    {
+        return this->primary->getColumnDefinition(column);
+    }
+
+    /**
+     * Gets a list of columns
+     */
+    public function getColumnList(var columnList) -> string
+    {
+        return this->primary->getColumnList(columnList);
+    }
+
+    /**
+     * Gets the unique identifier of the primary connection
+     */
+    public function getConnectionId() -> string
+    {
+        return this->primary->getConnectionId();
+    }
+
+    /**
+     * Return descriptor used to connect to the primary
+     */
+    public function getDescriptor() -> array
+    {
+        return this->primary->getDescriptor();
+    }
+
+    /**
+     * Returns internal dialect instance
+     */
+    public function getDialect() -> <DialectInterface>
+    {
+        return this->primary->getDialect();
+    }
+
+    /**
+     * Returns the name of the dialect used
+     */
+    public function getDialectType() -> string
+    {
+        return this->primary->getDialectType();
+    }
+
+    /**
+     * Return the default identity value to insert in an identity column
+     */
+    public function getDefaultIdValue() -> <RawValue>
+    {
+        return this->primary->getDefaultIdValue();
+    }
+
+    /**
+     * Return internal PDO handler of the primary
+     */
+    public function getInternalHandler() -> <\PDO>
+    {
+        return this->primary->getInternalHandler();
+    }
+
+    /**
+     * Returns the savepoint name to use for nested transactions
+     */
+    public function getNestedTransactionSavepointName() -> string
+    {
+        return this->primary->getNestedTransactionSavepointName();
+    }
+
+    /**
+     * Returns the primary connection
+     */
+    public function getPrimary() -> <AdapterInterface>
+    {
+        return this->primary;
+    }
+
+    /**
+     * Returns the adapter the next SELECT statement will be sent to
+     */
+    public function getReadAdapter() -> <AdapterInterface>
+    {
+        var candidates, index, now, weight;
+
+        if this->sticky || this->primary->isUnderTransaction() {
+            return this->primary;
+        }
+
+        let now = microtime(true);
+
+        if this->replica !== null {
+            if this->checkReplica(this->replica, now) {
+                return this->adapters[this->replica];
+            }
+
+            let this->replica = null;
+        }
+
+        let candidates = [];
+
+        for index, weight in this->weights {
+            if weight > 0 && this->ejectedUntil[index] <= now {
+                let candidates[index] = weight;
+            }
+        }
+
+        while !empty candidates {
+            let index = this->pickReplica(candidates);
+
+            if this->checkReplica(index, now) {
+                let this->replica = index;
+
+                return this->adapters[index];
+            }
+
+            unset candidates[index];
+        }
+
+        return this->primary;
+    }
+
+    /**
+     * Active SQL statement in the object without replace bound parameters
+     */
+    public function getRealSQLStatement() -> string
+    {
+        return this->lastAdapter->getRealSQLStatement();
+    }
+
+    /**
+     * Returns the status of each replica: weight, whether it is ejected,
+     * the last lag measured and whether it is the one used for reads
+     */
+    public function getReplicaStatus() -> array
+    {
+        var index, now, weight;
+        array status;
+
+        let now    = microtime(true),
+            status = [];
+
+        for index, weight in this->weights {
+            let status[index] = [
+                "weight"  : weight,
+                "ejected" : this->ejectedUntil[index] > now,
+                "lag"     : this->lags[index],
+                "active"  : this->replica === index
+            ];
+        }
+
+        return status;
+    }
+
+    /**
+     * Active SQL statement in the object
+     */
+    public function getSQLStatement() -> string
+    {
+        return this->lastAdapter->getSQLStatement();
+    }
+
+    /**
+     * Active SQL statement in the object
+     */
+    public function getSQLBindTypes() -> array
+    {
+        return this->lastAdapter->getSQLBindTypes();
+    }
+
+    /**
+     * Active SQL statement in the object
+     */
+    public function getSQLVariables() -> array
+    {
+        return this->lastAdapter->getSQLVariables();
+    }
+
+    /**
+     * Returns type of database system the adapter is used for
+     */
+    public function getType() -> string
+    {
+        return this->primary->getType();
+    }
+
+    /**
+     * Inserts data into a table using custom RDBMS SQL syntax
+     */
+    public function insert(string table, array! values, fields = null, dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->insert(table, values, fields, dataTypes);
+    }
+
+    /**
+     * Inserts data into a table using custom RBDM SQL syntax
+     */
+    public function insertAsDict(string table, data, var dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->insertAsDict(table, data, dataTypes);
+    }
+
+    /**
+     * Returns if nested transactions should use savepoints
+     */
+    public function isNestedTransactionsWithSavepoints() -> bool
+    {
+        return this->primary->isNestedTransactionsWithSavepoints();
+    }
+
+    /**
+     * Checks whether reads are sent to the primary
+     */
+    public function isSticky() -> bool
+    {
+        return this->sticky;
+    }
+
+    /**
+     * Checks whether the primary is under database transaction
+     */
+    public function isUnderTransaction() -> bool
+    {
+        return this->primary->isUnderTransaction();
+    }
+
+    /**
+     * Returns insert id for the auto_increment column inserted in the last SQL
+     * statement
+     */
+    public function lastInsertId(sequenceName = null)
+    {
+        return this->primary->lastInsertId(sequenceName);
+    }
+
+    /**
+     * Appends a LIMIT clause to sqlQuery argument
+     */
+    public function limit(string! sqlQuery, int number) -> string
+    {
+        return this->primary->limit(sqlQuery, number);
+    }
+
+    /**
+     * List all tables on a database
+     */
+    public function listTables(string! schemaName = null) -> array
+    {
+        return this->primary->listTables(schemaName);
+    }
+
+    /**
+     * List all views on a database
+     */
+    public function listViews(string! schemaName = null) -> array
+    {
+        return this->primary->listViews(schemaName);
+    }
+
+    /**
+     * Modifies a table column based on a definition
+     */
+    public function modifyColumn(string! tableName, string! schemaName, <ColumnInterface> column, <ColumnInterface> currentColumn = null) -> bool
+    {
+        return this->getWriteAdapter()->modifyColumn(tableName, schemaName, column, currentColumn);
+    }
+
+    /**
+     * Sends SELECT statements to a replica and any other statement to the
+     * primary
+     */
+    public function query(string! sqlStatement, var placeholders = null, var dataTypes = null) -> <ResultInterface> | bool
+    {
+        return this->getAdapterFor(sqlStatement)->query(sqlStatement, placeholders, dataTypes);
+    }
+
+    /**
+     * Releases given savepoint
+     */
+    public function releaseSavepoint(string! name) -> bool
+    {
+        return this->getWriteAdapter()->releaseSavepoint(name);
+    }
+
+    /**
+     * Rollbacks the active transaction of the primary
+     */
+    public function rollback(bool nesting = true) -> bool
+    {
+        return this->getWriteAdapter()->rollback(nesting);
+    }
+
+    /**
+     * Rollbacks given savepoint
+     */
+    public function rollbackSavepoint(string! name) -> bool
+    {
+        return this->getWriteAdapter()->rollbackSavepoint(name);
+    }
+
+    /**
+     * Returns a SQL modified with a LOCK IN SHARE MODE clause
+     */
+    public function sharedLock(string! sqlQuery) -> string
+    {
+        return this->primary->sharedLock(sqlQuery);
+    }
+
+    /**
+     * Set if nested transactions should use savepoints
+     */
+    public function setNestedTransactionsWithSavepoints(bool nestedTransactionsWithSavepoints) -> <AdapterInterface>
+    {
+        this->primary->setNestedTransactionsWithSavepoints(
+            nestedTransactionsWithSavepoints
+        );
+
+        return this;
+    }
+
+    /**
+     * Sends reads to the primary (true) or to the replicas again (false)
+     */
+    public function setSticky(bool sticky) -> <Pool>
+    {
+        let this->sticky = sticky;
+
+        return this;
+    }
+
+    /**
+     * Check whether the database system requires a sequence to produce
+     * auto-numeric values
+     */
+    public function supportSequences() -> bool
+    {
+        return this->primary->supportSequences();
+    }
+
+    /**
+     * Generates SQL checking for the existence of a schema.table
+     */
+    public function tableExists(string! tableName, string! schemaName = null) -> bool
+    {
+        return this->primary->tableExists(tableName, schemaName);
+    }
+
+    /**
+     * Gets creation options from a table
+     */
+    public function tableOptions(string! tableName, string schemaName = null) -> array
+    {
+        return this->primary->tableOptions(tableName, schemaName);
+    }
+
+    /**
+     * Updates data on a table using custom RDBMS SQL syntax
+     */
+    public function update(string table, fields, values, whereCondition = null, dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->update(table, fields, values, whereCondition, dataTypes);
+    }
+
+    /**
+     * Updates data on a table using custom RBDM SQL syntax
+     */
+    public function updateAsDict(string table, var data, var whereCondition = null, var dataTypes = null) -> bool
+    {
+        return this->getWriteAdapter()->updateAsDict(table, data, whereCondition, dataTypes);
+    }
+
+    /**
+     * Inserts or updates a row on the primary (see
+     * Phalcon\Db\Adapter\AbstractAdapter::upsert())
+     */
+    public function upsert(string table, array! values, array! fields, array! conflictFields, var dataTypes = null) -> bool
+    {
+        var adapter;
+
+        let adapter = this->getWriteAdapter();
+
+        if unlikely !method_exists(adapter, "upsert") {
+            throw new Exception("The primary connection does not support upserts");
+        }
+
+        return adapter->{"upsert"}(table, values, fields, conflictFields, dataTypes);
+    }
+
+    /**
+     * Check whether the database system requires an explicit value for
+     * identity columns
+     */
+    public function useExplicitIdValue() -> bool
+    {
+        return this->primary->useExplicitIdValue();
+    }
+
+    /**
+     * Generates SQL checking for the existence of a schema.view
+     */
+    public function viewExists(string! viewName, string! schemaName = null) -> bool
+    {
+        return this->primary->viewExists(viewName, schemaName);
+    }
+
+    /**
+     * Returns the replication lag of a replica in seconds, or null when the
+     * replica does not replicate
+     */
+    protected function getReplicaLag(<AdapterInterface> replica) -> float | null
+    {
+        var lag, row;
+
+        if this->lagQuery !== null {
+            let lag = replica->fetchColumn(this->lagQuery);
+
+            if lag === false || lag === null {
+                return null;
+            }
+
+            return (float) lag;
+        }
+
+        switch replica->getType() {
+            case "mysql":
+                let row = replica->fetchOne("SHOW SLAVE STATUS", Enum::FETCH_ASSOC);
+
+                /**
+                 * Not configured as a replica
+                 */
+                if empty row {
+                    return 0.0;
+                }
+
+                if !fetch lag, row["Seconds_Behind_Master"] {
+                    return null;
+                }
+
+                if lag === null {
+                    return null;
+                }
+
+                return (float) lag;
+
+            case "pgsql":
+                let lag = replica->fetchColumn(
+                    "SELECT CASE WHEN pg_is_in_recovery() THEN COALESCE(EXTRACT(EPOCH FROM now() - pg_last_xact_replay_timestamp()), 0) ELSE 0 END"
+                );
+
+                if lag === false || lag === null {
+                    return null;
+                }
+
+                return (float) lag;
+        }
+
+        return 0.0;
+    }
+
+    /**
+     * Connects a replica if needed and checks its lag when the check is due.
+     * Replicas that fail are ejected for `checkInterval` seconds.
+     */
+    private function checkReplica(var index, float now) -> bool
+    {
+        var adapter, e, lag;
+
+        if this->ejectedUntil[index] > now {
+            return false;
+        }
+
+        let adapter = this->adapters[index];
+
+        try {
+            if adapter instanceof Closure {
+                let adapter = call_user_func(adapter);
+            }
+        } catch \Throwable, e {
+            let this->ejectedUntil[index] = now + this->checkInterval;
+
+            return false;
+        }
+
+        if unlikely !(adapter instanceof AdapterInterface) {
+            throw new Exception(
+                "The closure of the replica '" . index . "' must return an adapter"
+            );
+        }
+
+        let this->adapters[index] = adapter;
+
+        if this->maxLag > 0 && now - this->checkedAt[index] >= this->checkInterval {
+            try {
+                let lag = this->getReplicaLag(adapter);
+            } catch \Throwable, e {
+                let lag = null;
+            }
+
+            let this->checkedAt[index] = now,
+                this->lags[index]      = lag;
+
+            if lag === null || lag > this->maxLag {
+                let this->ejectedUntil[index] = now + this->checkInterval;
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns the adapter for a statement: SELECT statements that do not
+     * lock rows are reads. SELECTs calling functions with side effects
+     * (`nextval()`, `GET_LOCK()`, `pg_advisory_lock()`...) cannot be told
+     * apart and need the primary, through getPrimary() or setSticky(true).
+     */
+    private function getAdapterFor(string sqlStatement) -> <AdapterInterface>
+    {
+        string statement;
+
+        let statement = ltrim(sqlStatement);
+
+        if strncasecmp(statement, "SELECT", 6) === 0 && !AbstractAdapter::isLockingRead(statement) {
+            let this->lastAdapter = this->getReadAdapter();
+
+            return this->lastAdapter;
+        }
+
+        return this->getWriteAdapter();
+    }
+
+    /**
+     * Returns the primary for a write, which makes the next reads go to the
+     * primary too
+     */
+    private function getWriteAdapter() -> <AdapterInterface>
+    {
+        if this->stickyAfterWrite {
+            let this->sticky = true;
+        }
+
+        let this->lastAdapter = this->primary;
+
+        return this->primary;
+    }
+
+    /**
+     * Picks a replica at random, by weight
+     */
+    private function pickReplica(array candidates) -> var
+    {
+        var index, weight;
+        int pick;
+
+        let pick = mt_rand(1, array_sum(candidates));
+
+        for index, weight in candidates {
+            let pick -= weight;
+
+            if pick <= 0 {
+                return index;
+            }
+        }
+
+        return index;
+    }
+}
@@ -571,6 +571,46 @@ abstract class Dialect implements DialectInterface
         return this->supportsSavePoints();
     }
 
+    /**
+     * Returns an INSERT modified to update the existing row when it conflicts
+     * with the `conflictFields` (primary or unique key)
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * // INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+     * echo $sql;
+     *```
+     */
+    public function upsert(string! sqlInsert, array! conflictFields, array! updateFields) -> string
+    {
+        var field;
+        array conflicts, updates;
+
+        let conflicts = [];
+
+        for field in conflictFields {
+            let conflicts[] = this->escape(field);
+        }
+
+        if !count(updateFields) {
+            return sqlInsert . " ON CONFLICT (" . join(", ", conflicts) . ") DO NOTHING";
+        }
+
+        let updates = [];
+
+        for field in updateFields {
+            let field     = this->escape(field),
+                updates[] = field . " = EXCLUDED." . field;
+        }
+
+        return sqlInsert . " ON CONFLICT (" . join(", ", conflicts) . ") DO UPDATE SET " . join(", ", updates);
+    }
+
     /**
      * Returns the size of the column enclosed in parentheses
      */
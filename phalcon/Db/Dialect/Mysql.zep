@@ -779,6 +779,44 @@ class Mysql extends Dialect
         return "TRUNCATE TABLE " . table;
     }
 
+    /**
+     * Returns an INSERT modified with an ON DUPLICATE KEY UPDATE clause. The
+     * conflict is detected by MySQL on any primary or unique key.
+     *
+     *```php
+     * $sql = $dialect->upsert(
+     *     "INSERT INTO robots (id, name) VALUES (?, ?)",
+     *     ["id"],
+     *     ["name"]
+     * );
+     *
+     * // INSERT INTO robots (id, name) VALUES (?, ?) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)
+     * echo $sql;
+     *```
+     */
+    public function upsert(string! sqlInsert, array! conflictFields, array! updateFields) -> string
+    {
+        var field;
+        array updates;
+
+        let updates = [];
+
+        for field in updateFields {
+            let field     = this->escape(field),
+                updates[] = field . " = VALUES(" . field . ")";
+        }
+
+        /**
+         * Nothing to update, the row is left as it is
+         */
+        if !count(updates) {
+            let field     = this->escape(conflictFields[0]),
+                updates[] = field . " = " . field;
+        }
+
+        return sqlInsert . " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
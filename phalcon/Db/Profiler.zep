@@ -62,6 +62,34 @@ use Phalcon\Db\Profiler\Item;
  * echo "Final Time: ", $profile->getFinalTime(), "\n";
  * echo "Total Elapsed Time: ", $profile->getTotalElapsedSeconds(), "\n";
  * ```
+ *
+ * In aggregate mode the profiler keeps no profile per statement, so it can
+ * run in production: the statements (or a sample of them) are grouped by
+ * their fingerprint, the SQL without literals, with their count, total time,
+ * rows and a latency histogram, and the slowest statements are kept with
+ * their bind parameters. Memory is bounded by `maxFingerprints` and
+ * `maxSlowQueries`. Adapters with the profiler set call it directly, without
+ * the events manager.
+ *
+ * ```php
+ * use Phalcon\Db\Profiler;
+ *
+ * $profiler = new Profiler(
+ *     [
+ *         "aggregate"     => true,
+ *         "sampleRate"    => 0.1,
+ *         "slowThreshold" => 0.5,
+ *     ]
+ * );
+ *
+ * $connection->setProfiler($profiler);
+ *
+ * $profiler->exportOnShutdown(
+ *     function (array $snapshot) {
+ *         // send $snapshot to the metrics backend
+ *     }
+ * );
+ * ```
  */
 class Profiler
 {
@@ -72,6 +100,22 @@ class Profiler
      */
     protected activeProfile;
 
+    /**
+     * Statement being profiled in aggregate mode: SQL, variables, bind types
+     * and initial time, or null when it is not sampled
+     *
+     * @var array|null
+     */
+    protected activeStatement = null;
+
+    /**
+     * Whether statements are aggregated by fingerprint instead of profiled
+     * one by one
+     *
+     * @var bool
+     */
+    protected aggregate = false;
+
     /**
      * All the Phalcon\Db\Profiler\Item in the active profile
      *
@@ -79,6 +123,107 @@ class Profiler
      */
     protected allProfiles;
 
+    /**
+     * Number of statements per fingerprint
+     *
+     * @var array
+     */
+    protected counts = [];
+
+    /**
+     * Callable receiving the snapshot at the end of the request
+     *
+     * @var callable|null
+     */
+    protected exporter = null;
+
+    /**
+     * Fingerprints of the SQL statements already seen
+     *
+     * @var array
+     */
+    protected fingerprints = [];
+
+    /**
+     * Latency histogram per fingerprint
+     *
+     * @var array
+     */
+    protected histograms = [];
+
+    /**
+     * Longest time per fingerprint
+     *
+     * @var array
+     */
+    protected maxima = [];
+
+    /**
+     * @var int
+     */
+    protected maxFingerprints = 500;
+
+    /**
+     * @var int
+     */
+    protected maxSlowQueries = 20;
+
+    /**
+     * Shortest time per fingerprint
+     *
+     * @var array
+     */
+    protected minima = [];
+
+    /**
+     * Rows returned or affected per fingerprint
+     *
+     * @var array
+     */
+    protected rows = [];
+
+    /**
+     * Number of statements profiled in aggregate mode
+     *
+     * @var int
+     */
+    protected sampled = 0;
+
+    /**
+     * Share of the statements profiled in aggregate mode, from 0 to 1
+     *
+     * @var float
+     */
+    protected sampleRate = 1.0;
+
+    /**
+     * Slowest statements with their bind parameters
+     *
+     * @var array
+     */
+    protected slowQueries = [];
+
+    /**
+     * Statements taking longer (in seconds) are kept in the slow queries
+     *
+     * @var float
+     */
+    protected slowThreshold = 1.0;
+
+    /**
+     * Number of statements seen in aggregate mode
+     *
+     * @var int
+     */
+    protected statements = 0;
+
+    /**
+     * Total time per fingerprint
+     *
+     * @var array
+     */
+    protected times = [];
+
     /**
      * Total time spent by all profiles to complete
      *
@@ -86,6 +231,103 @@ class Profiler
      */
     protected totalSeconds = 0;
 
+    /**
+     * Phalcon\Db\Profiler constructor
+     *
+     * @param array options = [
+     *     'aggregate' => false,
+     *     'sampleRate' => 1.0,
+     *     'slowThreshold' => 1.0,
+     *     'maxFingerprints' => 500,
+     *     'maxSlowQueries' => 20
+     * ]
+     */
+    public function __construct(array options = [])
+    {
+        var option;
+
+        if fetch option, options["aggregate"] {
+            let this->aggregate = (bool) option;
+        }
+
+        if fetch option, options["sampleRate"] {
+            let this->sampleRate = (float) option;
+        }
+
+        if fetch option, options["slowThreshold"] {
+            let this->slowThreshold = (float) option;
+        }
+
+        if fetch option, options["maxFingerprints"] {
+            let this->maxFingerprints = (int) option;
+        }
+
+        if fetch option, options["maxSlowQueries"] {
+            let this->maxSlowQueries = (int) option;
+        }
+    }
+
+    /**
+     * Calls the exporter set with `exportOnShutdown()` with the snapshot
+     */
+    public function export() -> void
+    {
+        var exporter;
+
+        let exporter = this->exporter;
+
+        if exporter !== null {
+            call_user_func(exporter, this->getSnapshot());
+        }
+    }
+
+    /**
+     * Sets a callable that receives the snapshot when the request ends
+     */
+    public function exportOnShutdown(callable exporter) -> <Profiler>
+    {
+        if this->exporter === null {
+            register_shutdown_function([this, "export"]);
+        }
+
+        let this->exporter = exporter;
+
+        return this;
+    }
+
+    /**
+     * Returns the SQL statement without literals and with lists of
+     * placeholders collapsed, so that the same statement with different
+     * values has the same fingerprint
+     *
+     * ```php
+     * // SELECT * FROM robots WHERE id IN (?+) AND name = ?
+     * echo Profiler::fingerprint(
+     *     "SELECT * FROM robots WHERE id IN (1, 2, 3) AND name = 'Astro'"
+     * );
+     * ```
+     */
+    public static function fingerprint(string sqlStatement) -> string
+    {
+        return trim(
+            preg_replace(
+                [
+                    "/'(?:[^'\\\\]|\\\\.|'')*'/s",
+                    "/(?<![\\w.$])-?\\d+(?:\\.\\d+)?(?:e[+-]?\\d+)?\\b/i",
+                    "/\\(\\s*\\?(?:\\s*,\\s*\\?)+\\s*\\)/",
+                    "/\\s+/"
+                ],
+                [
+                    "?",
+                    "?",
+                    "(?+)",
+                    " "
+                ],
+                sqlStatement
+            )
+        );
+    }
+
     /**
      * Returns the last profile executed in the profiler
      */
@@ -99,9 +341,89 @@ class Profiler
      */
     public function getNumberTotalStatements() -> int
     {
+        if this->aggregate {
+            return this->statements;
+        }
+
         return count(this->allProfiles);
     }
 
+    /**
+     * Returns the statistics collected in aggregate mode: the number of
+     * statements seen and sampled, the count, total/min/max time, rows,
+     * percentiles and latency histogram (see `getHistogramBucket()`) per
+     * fingerprint and the slowest statements.
+     *
+     * The statistics per fingerprint, count included, only cover the
+     * sampled statements: with a `sampleRate` below 1, multiply the count,
+     * time and rows by `statements / sampled` to estimate the totals.
+     */
+    public function getSnapshot() -> array
+    {
+        var fingerprint, count, histogram;
+        array fingerprints;
+
+        let fingerprints = [];
+
+        for fingerprint, count in this->counts {
+            let histogram = this->histograms[fingerprint];
+
+            ksort(histogram);
+
+            let fingerprints[fingerprint] = [
+                "count"     : count,
+                "time"      : this->times[fingerprint],
+                "min"       : this->minima[fingerprint],
+                "max"       : this->maxima[fingerprint],
+                "rows"      : this->rows[fingerprint],
+                "p50"       : self::percentile(histogram, count, 0.5),
+                "p95"       : self::percentile(histogram, count, 0.95),
+                "p99"       : self::percentile(histogram, count, 0.99),
+                "histogram" : histogram
+            ];
+        }
+
+        return [
+            "statements"   : this->statements,
+            "sampled"      : this->sampled,
+            "totalSeconds" : this->totalSeconds,
+            "fingerprints" : fingerprints,
+            "slowQueries"  : this->slowQueries
+        ];
+    }
+
+    /**
+     * Returns the histogram bucket of a duration in seconds. Buckets are
+     * microseconds on a logarithmic scale with four linear sub-buckets per
+     * power of two, so the relative error is at most 25%.
+     */
+    public static function getHistogramBucket(float seconds) -> int
+    {
+        var exponent, micro;
+
+        let micro = (int) (seconds * 1000000);
+
+        if micro < 1 {
+            let micro = 1;
+        }
+
+        let exponent = (int) floor(log(micro, 2));
+
+        return exponent * 4 + (int) floor((micro / pow(2, exponent) - 1) * 4);
+    }
+
+    /**
+     * Returns the upper bound, in seconds, of a histogram bucket
+     */
+    public static function getHistogramBucketLimit(int bucket) -> float
+    {
+        var exponent;
+
+        let exponent = (int) floor(bucket / 4);
+
+        return pow(2, exponent) * (1 + ((bucket % 4) + 1) / 4) / 1000000;
+    }
+
     /**
      * Returns the total time in seconds spent by the profiles
      */
@@ -119,15 +441,61 @@ class Profiler
     }
 
     /**
-     * Resets the profiler, cleaning up all the profiles
+     * Resets the profiler, cleaning up all the profiles. In aggregate mode
+     * the statistics and the total time are reset too.
      */
     public function reset() -> <Profiler>
     {
         let this->allProfiles = [];
 
+        if !this->aggregate {
+            return this;
+        }
+
+        let this->activeStatement = null,
+            this->counts          = [],
+            this->fingerprints    = [],
+            this->histograms      = [],
+            this->maxima          = [],
+            this->minima          = [],
+            this->rows            = [],
+            this->sampled         = 0,
+            this->slowQueries     = [],
+            this->statements      = 0,
+            this->times           = [],
+            this->totalSeconds    = 0;
+
         return this;
     }
 
+    /**
+     * Starts the profile of a statement run by an adapter that has the
+     * profiler set. In aggregate mode only the statements sampled are timed.
+     */
+    public function startQuery(string sqlStatement, var sqlVariables = null, var sqlBindTypes = null) -> void
+    {
+        if !this->aggregate {
+            this->startProfile(sqlStatement, sqlVariables, sqlBindTypes);
+
+            return;
+        }
+
+        let this->statements++;
+
+        if this->sampleRate < 1 && mt_rand() / mt_getrandmax() >= this->sampleRate {
+            let this->activeStatement = null;
+
+            return;
+        }
+
+        let this->activeStatement = [
+            sqlStatement,
+            sqlVariables,
+            sqlBindTypes,
+            microtime(true)
+        ];
+    }
+
     /**
      * Starts the profile of a SQL sentence
      */
@@ -180,4 +548,149 @@ class Profiler
 
         return this;
     }
+
+    /**
+     * Stops the profile of a statement run by an adapter that has the
+     * profiler set, with the rows it returned or affected
+     */
+    public function stopQuery(int rows = 0) -> void
+    {
+        var activeStatement, bucket, elapsed, fingerprint, sqlStatement;
+
+        if !this->aggregate {
+            if typeof this->activeProfile == "object" {
+                this->stopProfile();
+            }
+
+            return;
+        }
+
+        let activeStatement = this->activeStatement;
+
+        if activeStatement === null {
+            return;
+        }
+
+        let this->activeStatement = null,
+            elapsed = microtime(true) - activeStatement[3],
+            sqlStatement = activeStatement[0];
+
+        if !fetch fingerprint, this->fingerprints[sqlStatement] {
+            /**
+             * Bounded cache of the fingerprints
+             */
+            if count(this->fingerprints) >= this->maxFingerprints * 2 {
+                let this->fingerprints = [];
+            }
+
+            let fingerprint = self::fingerprint(sqlStatement),
+                this->fingerprints[sqlStatement] = fingerprint;
+        }
+
+        let bucket = self::getHistogramBucket(elapsed),
+            this->totalSeconds = this->totalSeconds + elapsed;
+
+        let this->sampled++;
+
+        /**
+         * Fingerprints above the limit are counted together
+         */
+        if !isset this->counts[fingerprint] && count(this->counts) >= this->maxFingerprints {
+            let fingerprint = "(other)";
+        }
+
+        if !isset this->counts[fingerprint] {
+            let this->counts[fingerprint] = 1,
+                this->times[fingerprint] = elapsed,
+                this->rows[fingerprint] = rows,
+                this->minima[fingerprint] = elapsed,
+                this->maxima[fingerprint] = elapsed,
+                this->histograms[fingerprint] = [bucket : 1];
+        } else {
+            let this->counts[fingerprint] = this->counts[fingerprint] + 1,
+                this->times[fingerprint] = this->times[fingerprint] + elapsed,
+                this->rows[fingerprint] = this->rows[fingerprint] + rows;
+
+            if elapsed < this->minima[fingerprint] {
+                let this->minima[fingerprint] = elapsed;
+            }
+
+            if elapsed > this->maxima[fingerprint] {
+                let this->maxima[fingerprint] = elapsed;
+            }
+
+            if isset this->histograms[fingerprint][bucket] {
+                let this->histograms[fingerprint][bucket] = this->histograms[fingerprint][bucket] + 1;
+            } else {
+                let this->histograms[fingerprint][bucket] = 1;
+            }
+        }
+
+        if elapsed >= this->slowThreshold {
+            this->addSlowQuery(activeStatement, fingerprint, elapsed);
+        }
+    }
+
+    /**
+     * Keeps a slow statement, replacing the fastest one kept when the limit
+     * is reached
+     */
+    private function addSlowQuery(array activeStatement, string fingerprint, float elapsed) -> void
+    {
+        var fastest, index, slowQuery;
+
+        let slowQuery = [
+            "sql"          : activeStatement[0],
+            "fingerprint"  : fingerprint,
+            "time"         : elapsed,
+            "sqlVariables" : activeStatement[1],
+            "sqlBindTypes" : activeStatement[2]
+        ];
+
+        if count(this->slowQueries) < this->maxSlowQueries {
+            let this->slowQueries[] = slowQuery;
+
+            return;
+        }
+
+        let fastest = null;
+
+        for index, slowQuery in this->slowQueries {
+            if fastest === null || slowQuery["time"] < this->slowQueries[fastest]["time"] {
+                let fastest = index;
+            }
+        }
+
+        if fastest !== null && this->slowQueries[fastest]["time"] < elapsed {
+            let this->slowQueries[fastest] = [
+                "sql"          : activeStatement[0],
+                "fingerprint"  : fingerprint,
+                "time"         : elapsed,
+                "sqlVariables" : activeStatement[1],
+                "sqlBindTypes" : activeStatement[2]
+            ];
+        }
+    }
+
+    /**
+     * Returns the upper bound of the bucket holding a percentile
+     */
+    private static function percentile(array histogram, int count, float percentile) -> float
+    {
+        var bucket, number;
+        int seen, target;
+
+        let target = (int) ceil(count * percentile),
+            seen = 0;
+
+        for bucket, number in histogram {
+            let seen += number;
+
+            if seen >= target {
+                return self::getHistogramBucketLimit(bucket);
+            }
+        }
+
+        return 0.0;
+    }
 }
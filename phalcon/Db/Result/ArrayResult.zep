@@ -0,0 +1,179 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Db\Result;
+
+use Phalcon\Db\Enum;
+use Phalcon\Db\Exception;
+use Phalcon\Db\ResultInterface;
+
+/**
+ * Result of a statement whose rows have already been fetched, for instance by
+ * `Phalcon\Db\Adapter\AbstractAdapter::queryParallel()`
+ *
+ * ```php
+ * $result = new \Phalcon\Db\Result\ArrayResult(
+ *     [
+ *         ["id" => 1, "name" => "Robotina"],
+ *         ["id" => 2, "name" => "Astro Boy"],
+ *     ]
+ * );
+ *
+ * while ($robot = $result->fetch()) {
+ *     echo $robot["name"];
+ * }
+ * ```
+ */
+class ArrayResult implements ResultInterface
+{
+    /**
+     * Active fetch mode
+     */
+    protected fetchMode = Enum::FETCH_ASSOC;
+
+    /**
+     * Position of the next row
+     *
+     * @var int
+     */
+    protected position = 0;
+
+    /**
+     * Rows as associative arrays
+     *
+     * @var array
+     */
+    protected rows = [];
+
+    /**
+     * Phalcon\Db\Result\ArrayResult constructor
+     */
+    public function __construct(array rows)
+    {
+        let this->rows = array_values(rows);
+    }
+
+    /**
+     * Moves the cursor to a row
+     */
+    public function dataSeek(long number) -> void
+    {
+        let this->position = number;
+    }
+
+    /**
+     * Moves the cursor back to the first row
+     */
+    public function execute() -> bool
+    {
+        let this->position = 0;
+
+        return true;
+    }
+
+    /**
+     * Returns the next row in the active fetch mode or false if there are no
+     * more rows
+     */
+    public function $fetch() -> var
+    {
+        var row;
+
+        if !fetch row, this->rows[this->position] {
+            return false;
+        }
+
+        let this->position++;
+
+        return this->format(row, this->fetchMode);
+    }
+
+    /**
+     * Returns the rows that have not been fetched yet
+     */
+    public function fetchAll(var fetchStyle = null) -> array
+    {
+        var fetchMode, row;
+        array rows;
+
+        if typeof fetchStyle == "integer" {
+            let fetchMode = fetchStyle;
+        } else {
+            let fetchMode = this->fetchMode;
+        }
+
+        let rows = [];
+
+        loop {
+            if !fetch row, this->rows[this->position] {
+                break;
+            }
+
+            let rows[] = this->format(row, fetchMode);
+            let this->position++;
+        }
+
+        return rows;
+    }
+
+    /**
+     * Returns the next row or false if there are no more rows
+     */
+    public function fetchArray() -> var
+    {
+        return this->$fetch();
+    }
+
+    /**
+     * Array results have no PDO statement
+     */
+    public function getInternalResult() -> <\PDOStatement>
+    {
+        throw new Exception("The result has no internal PDO statement");
+    }
+
+    /**
+     * Gets number of rows of the result
+     */
+    public function numRows() -> int
+    {
+        return count(this->rows);
+    }
+
+    /**
+     * Changes the fetching mode: Enum::FETCH_ASSOC, Enum::FETCH_NUM,
+     * Enum::FETCH_BOTH or Enum::FETCH_OBJ
+     */
+    public function setFetchMode(int fetchMode) -> bool
+    {
+        let this->fetchMode = fetchMode;
+
+        return true;
+    }
+
+    /**
+     * Returns a row in a fetch mode
+     */
+    private function format(array row, int fetchMode) -> var
+    {
+        switch fetchMode {
+            case Enum::FETCH_NUM:
+                return array_values(row);
+
+            case Enum::FETCH_BOTH:
+                return array_merge(row, array_values(row));
+
+            case Enum::FETCH_OBJ:
+                return (object) row;
+        }
+
+        return row;
+    }
+}
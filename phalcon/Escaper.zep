@@ -38,6 +38,13 @@ class Escaper implements EscaperInterface
      */
     protected doubleEncode = true;
 
+    /**
+     * Escaped form of the ASCII characters for CSS
+     *
+     * @var array|null
+     */
+    protected cssEscapeMap = null;
+
     /**
      * @var string
      */
@@ -47,6 +54,13 @@ class Escaper implements EscaperInterface
 
     protected htmlQuoteType = 3;
 
+    /**
+     * Escaped form of the ASCII characters for javascript
+     *
+     * @var array|null
+     */
+    protected jsEscapeMap = null;
+
     /**
      * Detect the character encoding of a string to be handled by an encoder.
      * Special-handling for chr(172) and chr(128) to chr(159) which fail to be
@@ -94,6 +108,17 @@ class Escaper implements EscaperInterface
      */
     public function escapeCss(string css) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly
+         */
+        let escaped = this->escapeUtf8(css, true);
+
+        if escaped !== null {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -109,6 +134,17 @@ class Escaper implements EscaperInterface
      */
     public function escapeJs(string js) -> string
     {
+        var escaped;
+
+        /**
+         * Valid UTF-8 is escaped directly
+         */
+        let escaped = this->escapeUtf8(js, false);
+
+        if escaped !== null {
+            return escaped;
+        }
+
         /**
          * Normalize encoding to UTF-32
          * Escape the string
@@ -218,4 +254,105 @@ class Escaper implements EscaperInterface
     {
         let this->htmlQuoteType = quoteType;
     }
+
+    /**
+     * Escapes a valid UTF-8 string for CSS or javascript without converting
+     * it to UTF-32. The ASCII characters are replaced in a single strtr()
+     * pass and the remaining multibyte characters by their code point. The
+     * result is the same as the one of the UTF-32 escaping. Returns null for
+     * strings that must go through encoding detection.
+     */
+    private function escapeUtf8(string str, bool css) -> string | null
+    {
+        var escaped;
+
+        /**
+         * Empty strings, NUL bytes (which the UTF-32 escaping rejects) and
+         * invalid UTF-8 keep the existing behavior
+         */
+        if str === "" || false !== strpos(str, chr(0)) {
+            return null;
+        }
+
+        if unlikely !function_exists("mb_ord") {
+            return null;
+        }
+
+        if !preg_match("//u", str) {
+            return null;
+        }
+
+        let escaped = strtr(str, this->getEscapeMap(css));
+
+        if !preg_match("/[\\x80-\\xff]/", escaped) {
+            return escaped;
+        }
+
+        if css {
+            return preg_replace_callback(
+                "/[^\\x00-\\x7f]/u",
+                function (matches) {
+                    return "\\" . dechex(mb_ord(matches[0], "UTF-8")) . " ";
+                },
+                escaped
+            );
+        }
+
+        return preg_replace_callback(
+            "/[^\\x00-\\x7f]/u",
+            function (matches) {
+                return "\\x" . dechex(mb_ord(matches[0], "UTF-8"));
+            },
+            escaped
+        );
+    }
+
+    /**
+     * Returns the escaped form of the ASCII characters that are not
+     * alphanumeric (and, for javascript, not whitelisted)
+     */
+    private function getEscapeMap(bool css) -> array
+    {
+        var map, whitelist;
+        string character;
+        int code;
+
+        if css && typeof this->cssEscapeMap == "array" {
+            return this->cssEscapeMap;
+        }
+
+        if !css && typeof this->jsEscapeMap == "array" {
+            return this->jsEscapeMap;
+        }
+
+        let map       = [],
+            whitelist = " /*+-\t\n^$!?\\#}{)(][.,:;_|",
+            code      = 1;
+
+        while code < 128 {
+            let character = chr(code);
+
+            if (code >= 48 && code <= 57) || (code >= 65 && code <= 90) || (code >= 97 && code <= 122) {
+                let code++;
+
+                continue;
+            }
+
+            if css {
+                let map[character] = "\\" . dechex(code) . " ";
+            } elseif false === strpos(whitelist, character) {
+                let map[character] = "\\x" . dechex(code);
+            }
+
+            let code++;
+        }
+
+        if css {
+            let this->cssEscapeMap = map;
+        } else {
+            let this->jsEscapeMap = map;
+        }
+
+        return map;
+    }
 }
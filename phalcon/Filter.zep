@@ -194,6 +194,54 @@ class Filter implements FilterInterface
         return this->sanitizer(value, sanitizers);
     }
 
+    /**
+     * Sanitizes a column of values (for instance the cells of a CSV column)
+     * with a chain of sanitizers. Each sanitizer is resolved once and
+     * applied to the whole column before the next one. Unless they have
+     * been replaced in the locator, the built-in sanitizers that PHP can
+     * apply to a whole array (absint, alnum, alpha, email, float, int,
+     * lower, striptags, trim, upper) do so in a single internal call instead
+     * of one call per value.
+     *
+     * Keys are preserved. Values are expected to be scalars.
+     *
+     *```php
+     * $cells = $filter->sanitizeColumn(
+     *     $cells,
+     *     [
+     *         "trim",
+     *         "lower",
+     *     ]
+     * );
+     *```
+     */
+    public function sanitizeColumn(array! values, var sanitizers) -> array
+    {
+        var sanitizer, sanitizerKey, sanitizerName, sanitizerParams;
+
+        if typeof sanitizers != "array" {
+            let sanitizers = [sanitizers];
+        }
+
+        for sanitizerKey, sanitizer in sanitizers {
+            if typeof sanitizer === "array" {
+                let sanitizerName   = sanitizerKey,
+                    sanitizerParams = sanitizer;
+            } else {
+                let sanitizerName   = sanitizer,
+                    sanitizerParams = [];
+            }
+
+            let values = this->processColumn(
+                values,
+                sanitizerName,
+                sanitizerParams
+            );
+        }
+
+        return values;
+    }
+
     /**
      * Set a new service to the mapper array
      */
@@ -241,6 +289,156 @@ class Filter implements FilterInterface
         return arrayValue;
     }
 
+    /**
+     * Changes the case of a column in one mb_convert_case() call. Returns
+     * null when the column cannot be joined safely.
+     */
+    private function convertColumnCase(array values, bool upper) -> array | null
+    {
+        var parts, separator;
+
+        if unlikely !function_exists("mb_convert_case") {
+            return null;
+        }
+
+        /**
+         * The values are joined with NUL bytes, which must not appear in the
+         * values themselves
+         */
+        let separator = chr(0),
+            parts     = implode(separator, values);
+
+        if substr_count(parts, separator) !== count(values) - 1 {
+            return null;
+        }
+
+        if upper {
+            let parts = mb_convert_case(parts, MB_CASE_UPPER, "UTF-8");
+        } else {
+            let parts = mb_convert_case(parts, MB_CASE_LOWER, "UTF-8");
+        }
+
+        let parts = explode(separator, parts);
+
+        if unlikely count(parts) !== count(values) {
+            return null;
+        }
+
+        return array_combine(
+            array_keys(values),
+            parts
+        );
+    }
+
+    /**
+     * Applies one sanitizer to a column
+     */
+    private function processColumn(
+        array values,
+        string sanitizerName,
+        array sanitizerParams = []
+    ) -> array
+    {
+        var converted, definition, itemKey, itemValue, sanitizerObject;
+        array result;
+
+        if !this->has(sanitizerName) || count(values) === 0 {
+            return values;
+        }
+
+        let definition = this->mapper[sanitizerName];
+
+        /**
+         * Built-in sanitizers applied by PHP to the whole array
+         */
+        if typeof definition === "string" && count(sanitizerParams) === 0 {
+            switch definition {
+                case "Phalcon\\Filter\\Sanitize\\AbsInt":
+                    return array_map(
+                        "abs",
+                        array_map(
+                            "intval",
+                            filter_var(values, FILTER_SANITIZE_NUMBER_INT, FILTER_REQUIRE_ARRAY)
+                        )
+                    );
+
+                case "Phalcon\\Filter\\Sanitize\\Alnum":
+                    return preg_replace("/[^A-Za-z0-9]/", "", values);
+
+                case "Phalcon\\Filter\\Sanitize\\Alpha":
+                    return preg_replace("/[^A-Za-z]/", "", values);
+
+                case "Phalcon\\Filter\\Sanitize\\Email":
+                    return filter_var(
+                        values,
+                        FILTER_SANITIZE_EMAIL,
+                        FILTER_REQUIRE_ARRAY | FILTER_FLAG_EMAIL_UNICODE
+                    );
+
+                case "Phalcon\\Filter\\Sanitize\\FloatVal":
+                    return array_map(
+                        "floatval",
+                        filter_var(
+                            values,
+                            FILTER_SANITIZE_NUMBER_FLOAT,
+                            FILTER_REQUIRE_ARRAY | FILTER_FLAG_ALLOW_FRACTION
+                        )
+                    );
+
+                case "Phalcon\\Filter\\Sanitize\\IntVal":
+                    return array_map(
+                        "intval",
+                        filter_var(values, FILTER_SANITIZE_NUMBER_INT, FILTER_REQUIRE_ARRAY)
+                    );
+
+                case "Phalcon\\Filter\\Sanitize\\Lower":
+                    let converted = this->convertColumnCase(values, false);
+
+                    if converted !== null {
+                        return converted;
+                    }
+
+                    break;
+
+                case "Phalcon\\Filter\\Sanitize\\Striptags":
+                    return array_map("strip_tags", values);
+
+                case "Phalcon\\Filter\\Sanitize\\Trim":
+                    return array_map("trim", values);
+
+                case "Phalcon\\Filter\\Sanitize\\Upper":
+                    let converted = this->convertColumnCase(values, true);
+
+                    if converted !== null {
+                        return converted;
+                    }
+
+                    break;
+            }
+        }
+
+        /**
+         * Other sanitizers are resolved once for the whole column
+         */
+        let sanitizerObject = this->get(sanitizerName),
+            result          = [];
+
+        if count(sanitizerParams) === 0 {
+            for itemKey, itemValue in values {
+                let result[itemKey] = call_user_func(sanitizerObject, itemValue);
+            }
+        } else {
+            for itemKey, itemValue in values {
+                let result[itemKey] = call_user_func_array(
+                    sanitizerObject,
+                    array_merge([itemValue], sanitizerParams)
+                );
+            }
+        }
+
+        return result;
+    }
+
     /**
      * Internal sanitize wrapper for recursion
      */
@@ -47,7 +47,21 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
 
     protected options;
 
-    protected validation { set, get };
+    /**
+     * Validation plan (see compile())
+     *
+     * @var array|null
+     */
+    protected plan = null;
+
+    /**
+     * Validation running the plan, reused between isValid() calls
+     *
+     * @var Validation|null
+     */
+    protected planValidation = null;
+
+    protected validation { get };
 
     /**
      * Phalcon\Forms\Form constructor
@@ -133,6 +147,8 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
             let this->elements = elements;
         }
 
+        this->resetPlan();
+
         return this;
     }
 
@@ -258,6 +274,31 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this;
     }
 
+    /**
+     * Builds a validation plan (see Phalcon\Validation::compile()) from the
+     * validators and filters of the elements, along with the ones of the
+     * form validation. isValid() then runs the plan without rebuilding the
+     * validation on every call. Adding or removing elements, or setting the
+     * validation, discards the plan; validators added to an element
+     * afterwards require compiling the form again.
+     *
+     * The plan can be cached (for instance in APCu) and given to other
+     * instances of the form through setPlan().
+     */
+    public function compile() -> array
+    {
+        var validation;
+
+        let validation = this->createValidation();
+
+        this->prepareValidation(validation);
+
+        let this->plan           = validation->compile(),
+            this->planValidation = validation;
+
+        return this->plan;
+    }
+
     /**
      * Returns the number of elements in the form
      */
@@ -397,6 +438,14 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this->get(name)->getMessages();
     }
 
+    /**
+     * Returns the validation plan, if any
+     */
+    public function getPlan() -> array | null
+    {
+        return this->plan;
+    }
+
     /**
      * Returns the value of an option if present
      */
@@ -540,8 +589,7 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
      */
     public function isValid(var data = null, var entity = null) -> bool
     {
-        var messages, element, validators, name, filters, validator, validation,
-            elementMessage;
+        var messages, validation, elementMessage;
         bool validationStatus;
 
         if empty this->elements {
@@ -577,43 +625,26 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
 
         let validationStatus = true;
 
-        let validation = this->getValidation();
-
-        if typeof validation != "object" || !(validation instanceof ValidationInterface) {
-            // Create an implicit validation
-            let validation = new Validation();
-        }
-
-        for element in this->elements {
-            let validators = element->getValidators();
-
-            if count(validators) == 0 {
-                continue;
-            }
-
+        if this->plan !== null {
             /**
-             * Element's name
+             * Compiled forms reuse the validation running the plan
              */
-            let name = element->getName();
+            if this->planValidation === null {
+                let this->planValidation = this->createValidation();
 
-            /**
-            * Append (not overriding) element validators to validation class
-            */
-            for validator in validators {
-                validation->add(name, validator);
+                this->planValidation->setPlan(this->plan);
             }
 
-            /**
-             * Get filters in the element
-             */
-            let filters = element->getFilters();
+            let validation = this->planValidation;
+        } else {
+            let validation = this->getValidation();
 
-            /**
-             * Assign the filters to the validation
-             */
-            if typeof filters == "array" {
-                validation->setFilters(name, filters);
+            if typeof validation != "object" || !(validation instanceof ValidationInterface) {
+                // Create an implicit validation
+                let validation = new Validation();
             }
+
+            this->prepareValidation(validation);
         }
 
         /**
@@ -710,6 +741,8 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         if isset this->elements[name] {
             unset this->elements[name];
 
+            this->resetPlan();
+
             return true;
         }
 
@@ -765,6 +798,17 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this;
     }
 
+    /**
+     * Uses a plan returned by compile() to validate the form
+     */
+    public function setPlan(array! plan) -> <Form>
+    {
+        let this->plan           = plan,
+            this->planValidation = null;
+
+        return this;
+    }
+
     /**
      * Sets an option for the form
      */
@@ -785,6 +829,18 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
         return this;
     }
 
+    /**
+     * Sets the validation of the form
+     */
+    public function setValidation(<ValidationInterface> validation) -> <Form>
+    {
+        let this->validation = validation;
+
+        this->resetPlan();
+
+        return this;
+    }
+
     /**
      * Check if the current element in the iterator is valid
      */
@@ -792,4 +848,76 @@ class Form extends Injectable implements Countable, Iterator, AttributesInterfac
     {
         return isset this->elementsIndexed[this->position];
     }
+
+    /**
+     * Returns a copy of the form validation, or a new validation, for the
+     * plan
+     */
+    private function createValidation() -> <Validation>
+    {
+        var validation;
+
+        let validation = this->getValidation();
+
+        if typeof validation != "object" {
+            return new Validation();
+        }
+
+        if unlikely !(validation instanceof Validation) {
+            throw new Exception(
+                "Only Phalcon\\Validation validations can be compiled"
+            );
+        }
+
+        return clone validation;
+    }
+
+    /**
+     * Discards the validation plan and the validation running it
+     */
+    private function resetPlan() -> void
+    {
+        let this->plan           = null,
+            this->planValidation = null;
+    }
+
+    /**
+     * Appends the validators and filters of the elements to the validation
+     */
+    private function prepareValidation(<ValidationInterface> validation) -> void
+    {
+        var element, filters, name, validator, validators;
+
+        for element in this->elements {
+            let validators = element->getValidators();
+
+            if count(validators) == 0 {
+                continue;
+            }
+
+            /**
+             * Element's name
+             */
+            let name = element->getName();
+
+            /**
+            * Append (not overriding) element validators to validation class
+            */
+            for validator in validators {
+                validation->add(name, validator);
+            }
+
+            /**
+             * Get filters in the element
+             */
+            let filters = element->getFilters();
+
+            /**
+             * Assign the filters to the validation
+             */
+            if typeof filters == "array" {
+                validation->setFilters(name, filters);
+            }
+        }
+    }
 }
@@ -95,6 +95,70 @@ class Stream implements StreamInterface
         }
     }
 
+    /**
+     * Copies the stream to another stream without going through PHP
+     * strings. Plain files are memory mapped (mmap) by PHP while copying.
+     * Returns the number of bytes copied.
+     *
+     * @param resource|StreamInterface $destination
+     * @param int                      $length Bytes to copy, -1 for all
+     * @param int                      $offset Position to start from, 0 for
+     *                                         the current position
+     */
+    public function copyTo(var destination, int length = -1, int offset = 0) -> int
+    {
+        var bytes, data;
+        int total;
+
+        this->checkHandle();
+        this->checkReadable();
+
+        if typeof destination === "object" && destination instanceof StreamInterface {
+            if destination instanceof Stream {
+                let destination = destination->handle;
+            } else {
+                /**
+                 * Other implementations are written to in chunks
+                 */
+                if offset > 0 {
+                    this->seek(offset);
+                }
+
+                let total = 0;
+
+                while (length < 0 || total < length) && !this->eof() {
+                    if length < 0 || length - total > 8192 {
+                        let data = this->read(8192);
+                    } else {
+                        let data = this->read(length - total);
+                    }
+
+                    if data === "" {
+                        break;
+                    }
+
+                    destination->write(data);
+
+                    let total += strlen(data);
+                }
+
+                return total;
+            }
+        }
+
+        if unlikely (typeof destination !== "resource" || "stream" !== get_resource_type(destination)) {
+            throw new RuntimeException("The destination is not a valid stream");
+        }
+
+        let bytes = stream_copy_to_stream(this->handle, destination, length, offset);
+
+        if unlikely false === bytes {
+            throw new RuntimeException("Could not copy the file/stream");
+        }
+
+        return bytes;
+    }
+
     /**
      * Separates any underlying resources from the stream.
      *
@@ -220,6 +284,51 @@ class Stream implements StreamInterface
         return false !== strpbrk(mode, "xwca+");
     }
 
+    /**
+     * Sends the rest of the stream to the output (SAPI) and returns the
+     * number of bytes sent. Plain files are passed through memory mapped
+     * (mmap) by PHP; other streams are sent in chunks of `chunkSize` bytes so
+     * that the whole stream is never held in memory.
+     */
+    public function output(int chunkSize = 8192) -> int
+    {
+        var bytes, data;
+        int total;
+
+        this->checkHandle();
+        this->checkReadable();
+
+        if unlikely chunkSize < 1 {
+            throw new RuntimeException("The chunk size must be greater than zero");
+        }
+
+        if "plainfile" === this->getMetadata("wrapper_type") {
+            let bytes = fpassthru(this->handle);
+
+            if unlikely false === bytes {
+                throw new RuntimeException("Could not read from the file/stream");
+            }
+
+            return bytes;
+        }
+
+        let total = 0;
+
+        while !feof(this->handle) {
+            let data = fread(this->handle, chunkSize);
+
+            if unlikely false === data {
+                throw new RuntimeException("Could not read from the file/stream");
+            }
+
+            echo data;
+
+            let total += strlen(data);
+        }
+
+        return total;
+    }
+
     /**
      * Read data from the stream.
      *
@@ -0,0 +1,416 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Http\Message\Stream;
+
+use Iterator;
+use Phalcon\Helper\Json;
+use Psr\Http\Message\StreamInterface;
+use RuntimeException;
+
+/**
+ * Iterates over JSON documents read incrementally from a stream.
+ *
+ * Two layouts are supported: newline delimited JSON (one document per line)
+ * and a top level JSON array, in which case each element of the array is
+ * returned on its own. Only the chunk being scanned and the current record
+ * are kept in memory, regardless of the size of the payload.
+ *
+ *```php
+ * use Phalcon\Http\Message\Stream\Input;
+ * use Phalcon\Http\Message\Stream\JsonReader;
+ *
+ * $reader = new JsonReader(
+ *     new Input(),
+ *     JsonReader::MODE_NDJSON,
+ *     true
+ * );
+ *
+ * foreach ($reader as $position => $record) {
+ *     // ...
+ * }
+ *```
+ */
+class JsonReader implements Iterator
+{
+    const MODE_ARRAY  = 2;
+    const MODE_NDJSON = 1;
+
+    /**
+     * @var bool
+     */
+    protected associative = false;
+
+    /**
+     * Bytes read from the stream that have not been consumed yet
+     *
+     * @var string
+     */
+    protected buffer = "";
+
+    /**
+     * @var int
+     */
+    protected chunkSize = 8192;
+
+    /**
+     * @var mixed
+     */
+    protected current = null;
+
+    /**
+     * Nesting level of the element being scanned (array mode)
+     *
+     * @var int
+     */
+    protected depth = 0;
+
+    /**
+     * @var bool
+     */
+    protected escaped = false;
+
+    /**
+     * @var bool
+     */
+    protected finished = false;
+
+    /**
+     * @var bool
+     */
+    protected inString = false;
+
+    /**
+     * @var int
+     */
+    protected key = -1;
+
+    /**
+     * @var int
+     */
+    protected mode;
+
+    /**
+     * Offset in the buffer where the current record starts
+     *
+     * @var int
+     */
+    protected offset = 0;
+
+    /**
+     * Offset in the buffer where scanning resumes after a refill
+     *
+     * @var int
+     */
+    protected position = 0;
+
+    /**
+     * Whether the opening bracket has been consumed (array mode)
+     *
+     * @var bool
+     */
+    protected started = false;
+
+    /**
+     * @var StreamInterface
+     */
+    protected stream;
+
+    /**
+     * JsonReader constructor.
+     *
+     * @param StreamInterface $stream
+     * @param int             $mode
+     * @param bool            $associative
+     * @param int             $chunkSize
+     */
+    public function __construct(
+        <StreamInterface> stream,
+        int mode = self::MODE_NDJSON,
+        bool associative = false,
+        int chunkSize = 8192
+    ) {
+        if unlikely (mode !== self::MODE_NDJSON && mode !== self::MODE_ARRAY) {
+            throw new RuntimeException("Unknown JSON stream mode");
+        }
+
+        if unlikely chunkSize < 1 {
+            throw new RuntimeException("The chunk size must be greater than zero");
+        }
+
+        let this->stream      = stream,
+            this->mode        = mode,
+            this->associative = associative,
+            this->chunkSize   = chunkSize;
+    }
+
+    /**
+     * Returns the current decoded record
+     */
+    public function current() -> var
+    {
+        return this->current;
+    }
+
+    /**
+     * Returns the position of the current record
+     */
+    public function key() -> int
+    {
+        return this->key;
+    }
+
+    /**
+     * Moves to the next record
+     */
+    public function next() -> void
+    {
+        var record;
+
+        if this->finished {
+            return;
+        }
+
+        if this->mode === self::MODE_NDJSON {
+            let record = this->nextLine();
+        } else {
+            let record = this->nextElement();
+        }
+
+        if null === record {
+            let this->finished = true,
+                this->current  = null;
+
+            return;
+        }
+
+        let this->current = Json::decode(record, this->associative),
+            this->key++;
+    }
+
+    /**
+     * Rewinds the reader. Streams that have already been (partially) read
+     * must be seekable.
+     */
+    public function rewind() -> void
+    {
+        if this->key !== -1 || this->position > 0 || this->buffer !== "" {
+            if unlikely true !== this->stream->isSeekable() {
+                throw new RuntimeException(
+                    "The stream is not seekable and cannot be read again"
+                );
+            }
+
+            this->stream->rewind();
+        }
+
+        let this->buffer   = "",
+            this->current  = null,
+            this->depth    = 0,
+            this->escaped  = false,
+            this->finished = false,
+            this->inString = false,
+            this->key      = -1,
+            this->offset   = 0,
+            this->position = 0,
+            this->started  = false;
+
+        this->next();
+    }
+
+    /**
+     * Checks if the current position holds a record
+     */
+    public function valid() -> bool
+    {
+        return this->key !== -1 && !this->finished;
+    }
+
+    /**
+     * Reads the next chunk from the stream, discarding the bytes that have
+     * already been consumed. Returns false when the stream is exhausted.
+     */
+    private function fill() -> bool
+    {
+        var chunk;
+
+        if this->stream->eof() {
+            return false;
+        }
+
+        let chunk = this->stream->read(this->chunkSize);
+
+        if this->offset > 0 {
+            let this->buffer   = (string) substr(this->buffer, this->offset),
+                this->position = this->position - this->offset,
+                this->offset   = 0;
+        }
+
+        let this->buffer .= chunk;
+
+        return "" !== chunk || !this->stream->eof();
+    }
+
+    /**
+     * Returns the raw JSON of the next element of the top level array or
+     * null when the closing bracket has been reached
+     */
+    private function nextElement() -> string | null
+    {
+        char ch;
+        int i, length;
+        string buffer, element;
+
+        loop {
+            let buffer = this->buffer,
+                length = strlen(buffer),
+                i      = this->position;
+
+            while i < length {
+                let ch = buffer[i];
+
+                /**
+                 * Skip whitespace and separators between elements
+                 */
+                if this->depth === 0 && !this->inString && this->offset === i {
+                    if ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || (this->started && ch == ',') {
+                        let i++,
+                            this->offset = i;
+
+                        continue;
+                    }
+
+                    if !this->started {
+                        if unlikely ch != '[' {
+                            throw new RuntimeException(
+                                "The stream does not contain a JSON array"
+                            );
+                        }
+
+                        let this->started = true,
+                            i++,
+                            this->offset = i;
+
+                        continue;
+                    }
+
+                    if ch == ']' {
+                        let this->offset   = i + 1,
+                            this->position = i + 1;
+
+                        return null;
+                    }
+                }
+
+                if this->inString {
+                    if this->escaped {
+                        let this->escaped = false;
+                    } elseif ch == '\\' {
+                        let this->escaped = true;
+                    } elseif ch == '"' {
+                        let this->inString = false;
+                    }
+                } elseif ch == '"' {
+                    let this->inString = true;
+                } elseif ch == '[' || ch == '{' {
+                    let this->depth++;
+                } elseif ch == ']' || ch == '}' {
+                    if this->depth === 0 {
+                        /**
+                         * End of the top level array right after a scalar
+                         */
+                        let element        = (string) substr(buffer, this->offset, i - this->offset),
+                            this->offset   = i,
+                            this->position = i;
+
+                        return element;
+                    }
+
+                    let this->depth--;
+                } elseif ch == ',' && this->depth === 0 {
+                    let element        = (string) substr(buffer, this->offset, i - this->offset),
+                        this->offset   = i,
+                        this->position = i;
+
+                    return element;
+                }
+
+                let i++;
+
+                /**
+                 * A container closed at the top level is a complete element
+                 */
+                if this->depth === 0 && !this->inString && (ch == ']' || ch == '}') {
+                    let element        = (string) substr(buffer, this->offset, i - this->offset),
+                        this->offset   = i,
+                        this->position = i;
+
+                    return element;
+                }
+            }
+
+            let this->position = i;
+
+            if unlikely !this->fill() {
+                if this->started {
+                    throw new RuntimeException(
+                        "Unexpected end of the JSON array in the stream"
+                    );
+                }
+
+                throw new RuntimeException(
+                    "The stream does not contain a JSON array"
+                );
+            }
+        }
+    }
+
+    /**
+     * Returns the next non empty line of the stream or null when the stream
+     * has been exhausted
+     */
+    private function nextLine() -> string | null
+    {
+        var end;
+        string line;
+
+        loop {
+            let end = strpos(this->buffer, "\n", this->position);
+
+            if false === end {
+                let this->position = strlen(this->buffer);
+
+                if this->fill() {
+                    continue;
+                }
+
+                /**
+                 * Last line without a trailing new line
+                 */
+                let line         = trim(substr(this->buffer, this->offset)),
+                    this->offset = strlen(this->buffer);
+
+                if "" === line {
+                    return null;
+                }
+
+                return line;
+            }
+
+            let line           = trim(substr(this->buffer, this->offset, end - this->offset)),
+                this->offset   = end + 1,
+                this->position = end + 1;
+
+            if "" !== line {
+                return line;
+            }
+        }
+    }
+}
@@ -27,9 +27,20 @@ class Temp extends Stream
 {
     /**
      * Constructor
+     *
+     * Data is kept in memory until it grows over `maxMemory` bytes and is
+     * then moved to a temporary file. PHP's default threshold (2MB) is used
+     * when `maxMemory` is not greater than zero.
+     *
+     * @param string $mode
+     * @param int    $maxMemory
      */
-    public function __construct(var mode = "rb")
+    public function __construct(var mode = "rb", int maxMemory = 0)
     {
-        parent::__construct("php://temp", mode);
+        if maxMemory > 0 {
+            parent::__construct("php://temp/maxmemory:" . maxMemory, mode);
+        } else {
+            parent::__construct("php://temp", mode);
+        }
     }
 }
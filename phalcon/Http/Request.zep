@@ -18,6 +18,8 @@ use Phalcon\Helper\Json;
 use Phalcon\Http\Request\File;
 use Phalcon\Http\Request\FileInterface;
 use Phalcon\Http\Request\Exception;
+use Phalcon\Http\Message\Stream\Input;
+use Phalcon\Http\Message\Stream\JsonReader;
 use UnexpectedValueException;
 use stdClass;
 
@@ -512,6 +514,41 @@ class Request extends AbstractInjectionAware implements RequestInterface
         return Json::decode(rawBody, associative);
     }
 
+    /**
+     * Gets an iterator over the JSON HTTP raw request body that decodes one
+     * record at a time, without reading the whole body into memory.
+     *
+     * When no mode is passed, newline delimited JSON is assumed if the content
+     * type says so (`application/x-ndjson`, `application/jsonlines` etc.),
+     * otherwise the body is expected to be a top level JSON array.
+     *
+     *```php
+     * foreach ($request->getJsonRawBodyStream(true) as $record) {
+     *     // ...
+     * }
+     *```
+     */
+    public function getJsonRawBodyStream(bool associative = false, var mode = null, int chunkSize = 8192) -> <JsonReader>
+    {
+        var contentType;
+
+        if null === mode {
+            let contentType = (string) this->getContentType(),
+                mode        = JsonReader::MODE_ARRAY;
+
+            if stripos(contentType, "ndjson") !== false || stripos(contentType, "jsonl") !== false {
+                let mode = JsonReader::MODE_NDJSON;
+            }
+        }
+
+        return new JsonReader(
+            new Input(),
+            (int) mode,
+            associative,
+            chunkSize
+        );
+    }
+
     /**
      * Gets languages array and their quality accepted by the browser/client
      * from _SERVER["HTTP_ACCEPT_LANGUAGE"]
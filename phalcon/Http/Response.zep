@@ -25,6 +25,8 @@ use Phalcon\Http\Response\Headers;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
+use Phalcon\Http\Message\Stream;
+use Psr\Http\Message\StreamInterface;
 
 /**
  * Part of the HTTP cycle is return responses to the clients.
@@ -61,6 +63,16 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
     protected statusCodes;
 
+    /**
+     * @var StreamInterface|null
+     */
+    protected stream = null;
+
+    /**
+     * @var int
+     */
+    protected streamChunkSize = 8192;
+
     /**
      * Phalcon\Http\Response constructor
      */
@@ -338,6 +350,8 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
         if content != null {
             echo content;
+        } elseif this->stream !== null {
+            this->sendStream();
         } else {
             let file = this->file;
 
@@ -448,6 +462,32 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
         return this;
     }
 
+    /**
+     * Sets a stream as the body of the response. The stream is sent in
+     * chunks of `chunkSize` bytes (plain files are passed through directly)
+     * instead of being copied into the content first. The content set with
+     * setContent() takes precedence.
+     *
+     *```php
+     * use Phalcon\Http\Message\Stream;
+     *
+     * $response->setContentStream(
+     *     new Stream("/var/files/report.csv")
+     * );
+     *```
+     */
+    public function setContentStream(<StreamInterface> stream, int chunkSize = 8192) -> <ResponseInterface>
+    {
+        if unlikely chunkSize < 1 {
+            throw new Exception("The chunk size must be greater than zero");
+        }
+
+        let this->stream          = stream,
+            this->streamChunkSize = chunkSize;
+
+        return this;
+    }
+
     /**
      * Sets the response content-type mime, optionally the charset
      *
@@ -833,4 +873,39 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
         return this;
     }
+
+    /**
+     * Sends the stream set with setContentStream() from its beginning
+     */
+    private function sendStream() -> void
+    {
+        var data, stream;
+        int chunkSize;
+
+        let stream    = this->stream,
+            chunkSize = this->streamChunkSize;
+
+        if stream->isSeekable() {
+            stream->rewind();
+        }
+
+        if stream instanceof Stream {
+            stream->output(chunkSize);
+
+            return;
+        }
+
+        while !stream->eof() {
+            let data = stream->read(chunkSize);
+
+            /**
+             * Non blocking or slow streams may return nothing before the end
+             */
+            if data === "" {
+                break;
+            }
+
+            echo data;
+        }
+    }
 }
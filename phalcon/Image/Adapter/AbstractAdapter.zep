@@ -17,11 +17,37 @@ use Phalcon\Image\Exception;
  * Phalcon\Image\Adapter
  *
  * All image adapters must use this class
+ *
+ * Adapters created with `deferred` set to `true` do not decode the file and
+ * do not apply `crop()` and `resize()` right away. Consecutive crops and
+ * resizes are folded into a single source region and target size, which is
+ * resampled in one pass when another operation, `save()`, `render()` or
+ * `getImage()` needs the pixels. Drivers able to decode at a reduced scale
+ * (Imagick with JPEG files) only decode as many pixels as the target size
+ * requires.
+ *
+ *```php
+ * use Phalcon\Image\Adapter\Imagick;
+ *
+ * $image = new Imagick("original.jpg", null, null, true);
+ *
+ * $image
+ *     ->resize(400, 400, \Phalcon\Image\Enum::INVERSE)
+ *     ->crop(400, 400)
+ *     ->save("thumbnail.jpg", 85);
+ *```
  */
 abstract class AbstractAdapter implements AdapterInterface
 {
     protected static checked = false;
 
+    /**
+     * Whether crop() and resize() are recorded instead of being applied
+     *
+     * @var bool
+     */
+    protected deferred = false;
+
     protected file;
 
     /**
@@ -31,7 +57,14 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected height { get };
 
-    protected image { get };
+    protected image;
+
+    /**
+     * Whether the file has been decoded
+     *
+     * @var bool
+     */
+    protected loaded = true;
     /**
      * Image mime type
      *
@@ -41,6 +74,14 @@ abstract class AbstractAdapter implements AdapterInterface
 
     protected realpath { get };
 
+    /**
+     * Region of the source image that the recorded operations keep, along
+     * with the size of the source image it refers to
+     *
+     * @var array|null
+     */
+    protected pending = null;
+
     /**
      * Image type
      *
@@ -77,6 +118,8 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        this->flush();
+
         this->{"processBackground"}(colors[0], colors[1], colors[2], opacity);
 
         return this;
@@ -93,6 +136,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let radius = 100;
         }
 
+        this->flush();
+
         this->{"processBlur"}(radius);
 
         return this;
@@ -139,7 +184,42 @@ abstract class AbstractAdapter implements AdapterInterface
             let height = this->height - offsetY;
         }
 
-        this->{"processCrop"}(width, height, offsetX, offsetY);
+        if this->deferred {
+            this->deferCrop(width, height, offsetX, offsetY);
+        } else {
+            this->{"processCrop"}(width, height, offsetX, offsetY);
+        }
+
+        return this;
+    }
+
+    /**
+     * Decodes a deferred image now. Drivers able to decode at a reduced
+     * scale (Imagick with JPEG files) decode the smallest bitmap that still
+     * covers the given size, without resampling it; the width and height of
+     * the image become those of the decoded bitmap.
+     *
+     *```php
+     * $image = new \Phalcon\Image\Adapter\Imagick("original.jpg", null, null, true);
+     *
+     * $image->decode(800, 600);
+     *```
+     */
+    public function decode(int width = 0, int height = 0) -> <AdapterInterface>
+    {
+        var decoded;
+
+        if this->loaded || null !== this->pending {
+            this->flush();
+
+            return this;
+        }
+
+        let this->loaded = true,
+            decoded      = this->{"processLoad"}(width, height);
+
+        let this->width  = (int) decoded[0],
+            this->height = (int) decoded[1];
 
         return this;
     }
@@ -153,11 +233,23 @@ abstract class AbstractAdapter implements AdapterInterface
             let direction = Enum::HORIZONTAL;
         }
 
+        this->flush();
+
         this->{"processFlip"}(direction);
 
         return this;
     }
 
+    /**
+     * Returns the driver image, applying the recorded operations first
+     */
+    public function getImage()
+    {
+        this->flush();
+
+        return this->image;
+    }
+
 
     /**
      * This method scales the images using liquid rescaling method. Only support
@@ -174,6 +266,8 @@ abstract class AbstractAdapter implements AdapterInterface
         int deltaX = 0,
         int rigidity = 0
     ) -> <AbstractAdapter> {
+        this->flush();
+
         this->{"processLiquidRescale"}(width, height, deltaX, rigidity);
 
         return this;
@@ -184,6 +278,8 @@ abstract class AbstractAdapter implements AdapterInterface
       */
     public function mask(<AdapterInterface> watermark) -> <AdapterInterface>
     {
+        this->flush();
+
         this->{"processMask"}(watermark);
 
         return this;
@@ -198,6 +294,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let amount = 2;
         }
 
+        this->flush();
+
         this->{"processPixelate"}(amount);
 
         return this;
@@ -221,6 +319,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let opacity = 100;
         }
 
+        this->flush();
+
         this->{"processReflection"}(height, opacity, fadeIn);
 
         return this;
@@ -245,6 +345,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let quality = 100;
         }
 
+        this->flush();
+
         return this->{"processRender"}(ext, quality);
     }
 
@@ -336,7 +438,11 @@ abstract class AbstractAdapter implements AdapterInterface
         let width  = (int) max(round(width), 1);
         let height = (int) max(round(height), 1);
 
-        this->{"processResize"}(width, height);
+        if this->deferred {
+            this->deferResize(width, height);
+        } else {
+            this->{"processResize"}(width, height);
+        }
 
         return this;
     }
@@ -359,6 +465,8 @@ abstract class AbstractAdapter implements AdapterInterface
             }
         }
 
+        this->flush();
+
         this->{"processRotate"}(degrees);
 
         return this;
@@ -373,6 +481,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let file = (string) this->realpath;
         }
 
+        this->flush();
+
         this->{"processSave"}(file, quality);
 
         return this;
@@ -389,6 +499,8 @@ abstract class AbstractAdapter implements AdapterInterface
             let amount = 1;
         }
 
+        this->flush();
+
         this->{"processSharpen"}(amount);
 
         return this;
@@ -429,6 +541,8 @@ abstract class AbstractAdapter implements AdapterInterface
             str_split(color, 2)
         );
 
+        this->flush();
+
         this->{"processText"}(
             text,
             offsetX,
@@ -477,8 +591,138 @@ abstract class AbstractAdapter implements AdapterInterface
             let opacity = 100;
         }
 
+        this->flush();
+
         this->{"processWatermark"}(watermark, offsetX, offsetY, opacity);
 
         return this;
     }
+
+    /**
+     * Records a crop; the offsets and size are relative to the image as it
+     * would be after the operations recorded so far
+     */
+    protected function deferCrop(int width, int height, int offsetX, int offsetY) -> void
+    {
+        var pending;
+        double scaleX, scaleY;
+
+        let pending = this->getPending(),
+            scaleX  = pending["width"] / this->width,
+            scaleY  = pending["height"] / this->height;
+
+        let pending["x"]      = pending["x"] + offsetX * scaleX,
+            pending["y"]      = pending["y"] + offsetY * scaleY,
+            pending["width"]  = width * scaleX,
+            pending["height"] = height * scaleY;
+
+        let this->pending = pending,
+            this->width   = width,
+            this->height  = height;
+    }
+
+    /**
+     * Records a resize
+     */
+    protected function deferResize(int width, int height) -> void
+    {
+        let this->pending = this->getPending(),
+            this->width   = width,
+            this->height  = height;
+    }
+
+    /**
+     * Decodes the file if needed and applies the recorded crops and resizes
+     * as a single operation
+     */
+    protected function flush() -> void
+    {
+        var decoded, pending;
+        int decodedHeight, decodedWidth, height, offsetX, offsetY, width;
+        double scaleX, scaleY;
+
+        let pending = this->pending;
+
+        if likely (null === pending && this->loaded) {
+            return;
+        }
+
+        let this->pending = null;
+
+        if this->loaded {
+            let decoded = [
+                pending["sourceWidth"],
+                pending["sourceHeight"]
+            ];
+        } else {
+            let this->loaded = true;
+
+            if null === pending {
+                this->{"processLoad"}(0, 0);
+
+                return;
+            }
+
+            /**
+             * Smallest size of the whole source that still covers the region
+             * at the target size. Drivers may decode at that size or larger.
+             */
+            let decoded = this->{"processLoad"}(
+                (int) ceil(pending["sourceWidth"] * this->width / pending["width"]),
+                (int) ceil(pending["sourceHeight"] * this->height / pending["height"])
+            );
+        }
+
+        let decodedWidth  = (int) decoded[0],
+            decodedHeight = (int) decoded[1],
+            scaleX        = decodedWidth / pending["sourceWidth"],
+            scaleY        = decodedHeight / pending["sourceHeight"];
+
+        let offsetX = (int) round(pending["x"] * scaleX),
+            offsetY = (int) round(pending["y"] * scaleY),
+            width   = (int) max(round(pending["width"] * scaleX), 1),
+            height  = (int) max(round(pending["height"] * scaleY), 1);
+
+        if offsetX === 0 && offsetY === 0 && width === decodedWidth && height === decodedHeight {
+            if width != this->width || height != this->height {
+                this->{"processResize"}(this->width, this->height);
+            }
+
+            return;
+        }
+
+        if width == this->width && height == this->height {
+            this->{"processCrop"}(width, height, offsetX, offsetY);
+
+            return;
+        }
+
+        this->{"processResample"}(
+            this->width,
+            this->height,
+            offsetX,
+            offsetY,
+            width,
+            height
+        );
+    }
+
+    /**
+     * Returns the recorded region, starting with the whole image
+     */
+    private function getPending() -> array
+    {
+        if null === this->pending {
+            return [
+                "x"            : 0,
+                "y"            : 0,
+                "width"        : this->width,
+                "height"       : this->height,
+                "sourceWidth"  : this->width,
+                "sourceHeight" : this->height
+            ];
+        }
+
+        return this->pending;
+    }
 }
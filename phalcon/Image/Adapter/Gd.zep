@@ -17,15 +17,20 @@ class Gd extends AbstractAdapter
 {
     protected static checked = false;
 
-    public function __construct(string! file, int width = null, int height = null)
-    {
+    public function __construct(
+        string! file,
+        int width = null,
+        int height = null,
+        bool deferred = false
+    ) {
         var imageinfo;
 
         if !self::checked {
             self::check();
         }
 
-        let this->file = file;
+        let this->file     = file,
+            this->deferred = deferred;
 
         if file_exists(this->file) {
             let this->realpath = realpath(this->file);
@@ -38,41 +43,14 @@ class Gd extends AbstractAdapter
                 let this->mime = imageinfo["mime"];
             }
 
-            switch this->type {
-                case 1:
-                    let this->image = imagecreatefromgif(this->file);
-                    break;
-
-                case 2:
-                    let this->image = imagecreatefromjpeg(this->file);
-                    break;
-
-                case 3:
-                    let this->image = imagecreatefrompng(this->file);
-                    break;
-
-                case 15:
-                    let this->image = imagecreatefromwbmp(this->file);
-                    break;
-
-                case 16:
-                    let this->image = imagecreatefromxbm(this->file);
-                    break;
-
-                default:
-                    if this->mime {
-                        throw new Exception(
-                            "Installed GD does not support " . this->mime . " images"
-                        );
-                    }
-
-                    throw new Exception(
-                        "Installed GD does not support such images"
-                    );
+            /**
+             * Deferred images are decoded when the pixels are first needed
+             */
+            if deferred {
+                let this->loaded = false;
+            } else {
+                this->processLoad(0, 0);
             }
-
-            imagesavealpha(this->image, true);
-
         } else {
             if unlikely !width || !height {
                 throw new Exception(
@@ -104,6 +82,26 @@ class Gd extends AbstractAdapter
         }
     }
 
+    /**
+     * Copies the decoded image so that the clone can be changed on its own
+     */
+    public function __clone()
+    {
+        var image;
+        int height, width;
+
+        if typeof this->image == "resource" {
+            let width  = (int) imagesx(this->image),
+                height = (int) imagesy(this->image),
+                image  = this->processCreate(width, height);
+
+            imagecopy(image, this->image, 0, 0, 0, 0, width, height);
+            imagealphablending(image, true);
+
+            let this->image = image;
+        }
+    }
+
     public static function check() -> bool
     {
         var version;
@@ -231,6 +229,53 @@ class Gd extends AbstractAdapter
         }
     }
 
+    /**
+     * Decodes the file. GD cannot decode at a reduced scale, so the size hint
+     * is not used and the whole image is decoded.
+     */
+    protected function processLoad(int width, int height) -> array
+    {
+        switch this->type {
+            case 1:
+                let this->image = imagecreatefromgif(this->file);
+                break;
+
+            case 2:
+                let this->image = imagecreatefromjpeg(this->file);
+                break;
+
+            case 3:
+                let this->image = imagecreatefrompng(this->file);
+                break;
+
+            case 15:
+                let this->image = imagecreatefromwbmp(this->file);
+                break;
+
+            case 16:
+                let this->image = imagecreatefromxbm(this->file);
+                break;
+
+            default:
+                if this->mime {
+                    throw new Exception(
+                        "Installed GD does not support " . this->mime . " images"
+                    );
+                }
+
+                throw new Exception(
+                    "Installed GD does not support such images"
+                );
+        }
+
+        imagesavealpha(this->image, true);
+
+        return [
+            imagesx(this->image),
+            imagesy(this->image)
+        ];
+    }
+
     protected function processMask(<AdapterInterface> mask)
     {
         var maskImage, newimage, tempImage, color, index, r, g, b;
@@ -454,6 +499,41 @@ class Gd extends AbstractAdapter
         return ob_get_clean();
     }
 
+    /**
+     * Resamples a region of the image to the given size in a single pass
+     */
+    protected function processResample(
+        int width,
+        int height,
+        int offsetX,
+        int offsetY,
+        int sourceWidth,
+        int sourceHeight
+    ) {
+        var image;
+
+        let image = this->processCreate(width, height);
+
+        imagecopyresampled(
+            image,
+            this->image,
+            0,
+            0,
+            offsetX,
+            offsetY,
+            width,
+            height,
+            sourceWidth,
+            sourceHeight
+        );
+
+        imagedestroy(this->image);
+
+        let this->image  = image;
+        let this->width  = imagesx(image);
+        let this->height = imagesy(image);
+    }
+
     protected function processResize(int width, int height)
     {
         var image;
@@ -37,40 +37,38 @@ class Imagick extends AbstractAdapter
     /**
      * \Phalcon\Image\Adapter\Imagick constructor
      */
-    public function __construct(string! file, int width = null, int height = null)
-    {
-        var image;
-
+    public function __construct(
+        string! file,
+        int width = null,
+        int height = null,
+        bool deferred = false
+    ) {
         if !self::checked {
             self::check();
         }
 
-        let this->file = file;
+        let this->file     = file,
+            this->deferred = deferred;
 
         let this->image = new \Imagick();
 
         if file_exists(this->file) {
             let this->realpath = realpath(this->file);
 
-            if unlikely !this->image->readImage(this->realpath) {
-                 throw new Exception(
-                     "Imagick::readImage " . this->file . " failed"
-                 );
-            }
-
-            if !this->image->getImageAlphaChannel() {
-                this->image->setImageAlphaChannel(
-                    constant("Imagick::ALPHACHANNEL_SET")
-                );
-            }
-
-            if this->type == 1 {
-                let image = this->image->coalesceImages();
-
-                this->image->clear();
-                this->image->destroy();
+            /**
+             * Deferred images only read the header here; the pixels are
+             * decoded when they are first needed
+             */
+            if deferred {
+                if unlikely !this->image->pingImage(this->realpath) {
+                    throw new Exception(
+                        "Imagick::pingImage " . this->file . " failed"
+                    );
+                }
 
-                let this->image = image;
+                let this->loaded = false;
+            } else {
+                this->processLoad(0, 0);
             }
         } else {
             if unlikely (!width || !height) {
@@ -108,6 +106,16 @@ class Imagick extends AbstractAdapter
         }
     }
 
+    /**
+     * Copies the image so that the clone can be changed on its own
+     */
+    public function __clone()
+    {
+        if this->image instanceof \Imagick {
+            let this->image = clone this->image;
+        }
+    }
+
     /**
      * Checks if Imagick is enabled
      */
@@ -137,6 +145,8 @@ class Imagick extends AbstractAdapter
      */
     public function getInternalImInstance() -> <\Imagick>
     {
+        this->flush();
+
         return this->image;
     }
 
@@ -314,6 +324,48 @@ class Imagick extends AbstractAdapter
         let this->height = image->getImageHeight();
     }
 
+    /**
+     * Decodes the file. When a size is given, JPEG files are decoded by
+     * libjpeg at the smallest scale (1/2, 1/4 or 1/8) that is at least that
+     * large.
+     */
+    protected function processLoad(int width, int height) -> array
+    {
+        var image;
+
+        this->image->clear();
+
+        if width > 0 && height > 0 && strtolower(this->mime) === "image/jpeg" {
+            this->image->setOption("jpeg:size", width . "x" . height);
+        }
+
+        if unlikely !this->image->readImage(this->realpath) {
+             throw new Exception(
+                 "Imagick::readImage " . this->file . " failed"
+             );
+        }
+
+        if !this->image->getImageAlphaChannel() {
+            this->image->setImageAlphaChannel(
+                constant("Imagick::ALPHACHANNEL_SET")
+            );
+        }
+
+        if this->type == 1 {
+            let image = this->image->coalesceImages();
+
+            this->image->clear();
+            this->image->destroy();
+
+            let this->image = image;
+        }
+
+        return [
+            this->image->getImageWidth(),
+            this->image->getImageHeight()
+        ];
+    }
+
     /**
      * Composite one image onto another
      */
@@ -549,6 +601,37 @@ class Imagick extends AbstractAdapter
         return image->getImageBlob();
     }
 
+    /**
+     * Execute a crop and a resize of the cropped region.
+     */
+    protected function processResample(
+        int width,
+        int height,
+        int offsetX,
+        int offsetY,
+        int sourceWidth,
+        int sourceHeight
+    ) {
+        var image;
+
+        let image = this->image;
+
+        image->setIteratorIndex(0);
+
+        loop {
+            image->cropImage(sourceWidth, sourceHeight, offsetX, offsetY);
+            image->setImagePage(sourceWidth, sourceHeight, 0, 0);
+            image->scaleImage(width, height);
+
+            if image->nextImage() === false {
+                break;
+            }
+        }
+
+        let this->width  = image->getImageWidth();
+        let this->height = image->getImageHeight();
+    }
+
     /**
      * Execute a resize.
      */
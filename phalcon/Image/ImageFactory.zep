@@ -14,6 +14,7 @@ use Phalcon\Config;
 use Phalcon\Factory\AbstractFactory;
 use Phalcon\Helper\Arr;
 use Phalcon\Image\Adapter\AdapterInterface;
+use Phalcon\Image\Adapter\Imagick;
 
 /**
  * Phalcon\Image/ImageFactory
@@ -28,6 +29,187 @@ class ImageFactory extends AbstractFactory
         this->init(services);
     }
 
+    /**
+     * Creates several variants (size, format, quality) of an image, decoding
+     * the source once. The source is decoded at the smallest scale that
+     * still covers every variant when the driver supports it (Imagick with
+     * JPEG files), without being resampled, and each variant is resampled
+     * in a single pass from a copy of that bitmap.
+     *
+     * Returns, for each variant, the file written, its size and the time it
+     * took in milliseconds. The decoded source and the time spent decoding
+     * it are returned under the "source" key, which therefore cannot be used
+     * as the name of a variant.
+     *
+     *```php
+     * $factory = new \Phalcon\Image\ImageFactory();
+     *
+     * $result = $factory->batch(
+     *     "imagick",
+     *     "upload/original.jpg",
+     *     [
+     *         "large" => [
+     *             "file"    => "public/large.jpg",
+     *             "width"   => 1200,
+     *             "height"  => 1200,
+     *             "quality" => 85,
+     *         ],
+     *         "square" => [
+     *             "file"   => "public/square.webp",
+     *             "width"  => 150,
+     *             "height" => 150,
+     *             "crop"   => true,
+     *             "format" => "webp",
+     *         ],
+     *     ]
+     * );
+     *```
+     *
+     * @param array $variants = [
+     *     'file'    => 'thumbnail.jpg',
+     *     'width'   => 200,
+     *     'height'  => 200,
+     *     'master'  => \Phalcon\Image\Enum::AUTO,
+     *     'crop'    => false,
+     *     'format'  => null,
+     *     'quality' => -1
+     * ]
+     * @param int $threads Threads Imagick may use for each operation (0 for
+     *                     the ImageMagick default). Gd is single threaded.
+     */
+    public function batch(
+        string! name,
+        string! file,
+        array! variants,
+        int threads = 0
+    ) -> array {
+        var crop, format, height, image, key, master, quality, result,
+            source, start, variant, width;
+        int sourceHeight, sourceWidth;
+        double scale, variantScale;
+
+        if unlikely count(variants) === 0 {
+            throw new Exception("At least one variant is required");
+        }
+
+        for key, variant in variants {
+            if unlikely key === "source" {
+                throw new Exception(
+                    "The variant name 'source' is reserved for the source image"
+                );
+            }
+
+            if unlikely (typeof variant !== "array" || !isset variant["file"]) {
+                throw new Exception(
+                    "You must provide 'file' option for the variant '" . key . "'"
+                );
+            }
+
+            let width  = (int) Arr::get(variant, "width", 0),
+                height = (int) Arr::get(variant, "height", 0);
+
+            if unlikely (width < 1 && height < 1) {
+                throw new Exception(
+                    "You must provide 'width' or 'height' for the variant '" . key . "'"
+                );
+            }
+        }
+
+        let start        = microtime(true),
+            source       = this->newInstance(name, file, null, null, true),
+            sourceWidth  = (int) source->getWidth(),
+            sourceHeight = (int) source->getHeight(),
+            scale        = 0.0;
+
+        for variant in variants {
+            let variantScale = this->getBatchScale(
+                variant,
+                sourceWidth,
+                sourceHeight
+            );
+
+            if variantScale > scale {
+                let scale = variantScale;
+            }
+        }
+
+        if threads > 0 && source instanceof Imagick {
+            /**
+             * \Imagick::RESOURCETYPE_THREAD
+             */
+            source->setResourceLimit(6, threads);
+        }
+
+        /**
+         * Every variant is resampled from the decoded bitmap, so it only
+         * needs to cover the largest of them; it is not resampled itself
+         */
+        if scale < 1 {
+            source->decode(
+                (int) ceil(sourceWidth * scale),
+                (int) ceil(sourceHeight * scale)
+            );
+        } else {
+            source->decode();
+        }
+
+        let result = [
+            "source" : [
+                "file"   : file,
+                "width"  : source->getWidth(),
+                "height" : source->getHeight(),
+                "time"   : (microtime(true) - start) * 1000
+            ]
+        ];
+
+        for key, variant in variants {
+            let start   = microtime(true),
+                width   = (int) Arr::get(variant, "width", 0),
+                height  = (int) Arr::get(variant, "height", 0),
+                master  = (int) Arr::get(variant, "master", Enum::AUTO),
+                crop    = (bool) Arr::get(variant, "crop", false),
+                format  = Arr::get(variant, "format"),
+                quality = (int) Arr::get(variant, "quality", -1);
+
+            let image = clone source;
+
+            if crop && width > 0 && height > 0 {
+                image
+                    ->resize(width, height, Enum::INVERSE)
+                    ->crop(width, height);
+            } elseif width > 0 && height > 0 {
+                image->resize(width, height, master);
+            } elseif width > 0 {
+                image->resize(width, null, Enum::WIDTH);
+            } else {
+                image->resize(null, height, Enum::HEIGHT);
+            }
+
+            if format {
+                if quality < 1 {
+                    let quality = 100;
+                }
+
+                if unlikely false === file_put_contents(variant["file"], image->render(format, quality)) {
+                    throw new Exception(
+                        "The variant '" . key . "' could not be written to '" . variant["file"] . "'"
+                    );
+                }
+            } else {
+                image->save(variant["file"], quality);
+            }
+
+            let result[key] = [
+                "file"   : variant["file"],
+                "width"  : image->getWidth(),
+                "height" : image->getHeight(),
+                "time"   : (microtime(true) - start) * 1000
+            ];
+        }
+
+        return result;
+    }
+
     /**
      * Factory to create an instace from a Config object
      *
@@ -35,12 +217,13 @@ class ImageFactory extends AbstractFactory
      *     'adapter' => 'gd',
      *     'file' => 'image.jpg',
      *     'height' => null,
-     *     'width' => null
+     *     'width' => null,
+     *     'deferred' => false
      * ]
      */
     public function load(var config) -> <AdapterInterface>
     {
-        var height, file, name, width;
+        var deferred, height, file, name, width;
 
         let config = this->checkConfig(config);
 
@@ -56,9 +239,10 @@ class ImageFactory extends AbstractFactory
 
         let file   = Arr::get(config, "file"),
             height = Arr::get(config, "height", null),
-            width  = Arr::get(config, "width", null);
+            width  = Arr::get(config, "width", null),
+            deferred = Arr::get(config, "deferred", false);
 
-        return this->newInstance(name, file, width, height);
+        return this->newInstance(name, file, width, height, deferred);
     }
 
     /**
@@ -68,7 +252,8 @@ class ImageFactory extends AbstractFactory
         string! name,
         string! file,
         int width = null,
-        int height = null
+        int height = null,
+        bool deferred = false
     ) -> <AdapterInterface>
     {
         var definition;
@@ -82,7 +267,8 @@ class ImageFactory extends AbstractFactory
             [
                 file,
                 width,
-                height
+                height,
+                deferred
             ]
         );
     }
@@ -94,4 +280,46 @@ class ImageFactory extends AbstractFactory
             "imagick" : "Phalcon\\Image\\Adapter\\Imagick"
         ];
     }
+
+    /**
+     * Returns the fraction of the source size a variant is resampled from:
+     * the decoded source must be at least that large
+     */
+    private function getBatchScale(array variant, int sourceWidth, int sourceHeight) -> double
+    {
+        int height, master, width;
+        double scaleX, scaleY;
+
+        let width  = (int) Arr::get(variant, "width", 0),
+            height = (int) Arr::get(variant, "height", 0),
+            scaleX = (double) width / sourceWidth,
+            scaleY = (double) height / sourceHeight;
+
+        if scaleX <= 0 {
+            return scaleY;
+        }
+
+        if scaleY <= 0 {
+            return scaleX;
+        }
+
+        if Arr::get(variant, "crop", false) {
+            return max(scaleX, scaleY);
+        }
+
+        let master = (int) Arr::get(variant, "master", Enum::AUTO);
+
+        switch master {
+            case Enum::AUTO:
+                return min(scaleX, scaleY);
+
+            case Enum::WIDTH:
+                return scaleX;
+
+            case Enum::HEIGHT:
+                return scaleY;
+        }
+
+        return max(scaleX, scaleY);
+    }
 }
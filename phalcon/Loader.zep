@@ -10,9 +10,12 @@
 
 namespace Phalcon;
 
+use FilesystemIterator;
 use Phalcon\Loader\Exception;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Events\EventsAwareInterface;
+use RecursiveDirectoryIterator;
+use RecursiveIteratorIterator;
 
 /**
  * This component helps to load your project classes automatically based on some
@@ -39,9 +42,29 @@ use Phalcon\Events\EventsAwareInterface;
  * // Requiring this class will automatically include file vendor/example/adapter/Some.php
  * $adapter = new \Example\Adapter\Some();
  *```
+ *
+ * For production, the namespaces and directories can be compiled once (e.g.
+ * during deployment) into a class map that the loader consults without
+ * touching the filesystem:
+ *
+ *```php
+ * // deploy.php
+ * $loader->dumpClassMap("cache/classmap.php");
+ *
+ * // bootstrap
+ * $loader->loadClassMap("cache/classmap.php", true);
+ * $loader->register();
+ *```
  */
 class Loader implements EventsAwareInterface
 {
+    /**
+     * When enabled, only the registered classes (class map) are consulted
+     *
+     * @var bool
+     */
+    protected authoritative = false;
+
     protected checkedPath = null;
 
     /**
@@ -72,6 +95,14 @@ class Loader implements EventsAwareInterface
      */
     protected foundPath = null;
 
+    /**
+     * Classes that could not be found, so that repeated probes (e.g.
+     * `class_exists()`) do not hit the filesystem again
+     *
+     * @var array
+     */
+    protected missing = [];
+
     /**
      * @var array
      */
@@ -113,6 +144,18 @@ class Loader implements EventsAwareInterface
             return true;
         }
 
+        /**
+         * In authoritative mode the class map is all there is. Otherwise do
+         * not look again for a class that has already been searched for
+         */
+        if this->authoritative || isset this->missing[className] {
+            if typeof eventsManager == "object" {
+                eventsManager->fire("loader:afterCheckClass", this, className);
+            }
+
+            return false;
+        }
+
         let extensions = this->extensions;
 
         let ds = DIRECTORY_SEPARATOR,
@@ -250,6 +293,8 @@ class Loader implements EventsAwareInterface
             }
         }
 
+        let this->missing[className] = true;
+
         /**
          * Call 'afterCheckClass' event
          */
@@ -263,6 +308,51 @@ class Loader implements EventsAwareInterface
         return false;
     }
 
+    /**
+     * Scans the registered namespaces and directories and returns a class
+     * map (class name => file) that resolves classes the same way
+     * `autoLoad()` does. Registered classes take precedence. When a file name
+     * is passed, the map is also written to it as a PHP file returning an
+     * array, which opcache can cache.
+     */
+    public function dumpClassMap(string! file = null) -> array
+    {
+        var classMap, directories, directory, nsPrefix, temporary;
+
+        let classMap = this->classes;
+
+        for nsPrefix, directories in this->namespaces {
+            for directory in directories {
+                let classMap = this->scanDirectory(
+                    directory,
+                    rtrim(nsPrefix, "\\") . "\\",
+                    classMap
+                );
+            }
+        }
+
+        for directory in this->directories {
+            let classMap = this->scanDirectory(directory, "", classMap);
+        }
+
+        if !empty file {
+            let temporary = file . "." . uniqid("", true);
+
+            if unlikely false === file_put_contents(
+                temporary,
+                "<?php\n\nreturn " . var_export(classMap, true) . ";\n"
+            ) {
+                throw new Exception(
+                    "The class map could not be written to '" . file . "'"
+                );
+            }
+
+            rename(temporary, file);
+        }
+
+        return classMap;
+    }
+
     /**
      * Get the path the loader is checking for a path
      */
@@ -370,6 +460,30 @@ class Loader implements EventsAwareInterface
         }
     }
 
+    /**
+     * Registers a class map created by `dumpClassMap()`. In authoritative
+     * mode classes that are not in the map are never searched for in the
+     * registered namespaces and directories.
+     */
+    public function loadClassMap(string! file, bool authoritative = false) -> <Loader>
+    {
+        var classMap;
+
+        let classMap = require file;
+
+        if unlikely typeof classMap != "array" {
+            throw new Exception(
+                "The class map '" . file . "' must return an array"
+            );
+        }
+
+        this->registerClasses(classMap, true);
+
+        let this->authoritative = authoritative;
+
+        return this;
+    }
+
     /**
      * Register the autoload method
      */
@@ -401,6 +515,8 @@ class Loader implements EventsAwareInterface
      */
     public function registerClasses(array! classes, bool merge = false) -> <Loader>
     {
+        let this->missing = [];
+
         if merge {
             let this->classes = array_merge(this->classes, classes);
         } else {
@@ -415,6 +531,8 @@ class Loader implements EventsAwareInterface
      */
     public function registerDirs(array! directories, bool merge = false) -> <Loader>
     {
+        let this->missing = [];
+
         if merge {
             let this->directories = array_merge(this->directories, directories);
         } else {
@@ -446,7 +564,8 @@ class Loader implements EventsAwareInterface
     {
         var preparedNamespaces, name, paths;
 
-        let preparedNamespaces = this->prepareNamespace(namespaces);
+        let preparedNamespaces = this->prepareNamespace(namespaces),
+            this->missing      = [];
 
         if merge {
             for name, paths in preparedNamespaces {
@@ -480,7 +599,19 @@ class Loader implements EventsAwareInterface
      */
     public function setExtensions(array! extensions) -> <Loader>
     {
-        let this->extensions = extensions;
+        let this->extensions = extensions,
+            this->missing    = [];
+
+        return this;
+    }
+
+    /**
+     * Enables or disables the authoritative mode, in which only the registered
+     * classes (class map) are consulted
+     */
+    public function setAuthoritative(bool authoritative) -> <Loader>
+    {
+        let this->authoritative = authoritative;
 
         return this;
     }
@@ -536,6 +667,72 @@ class Loader implements EventsAwareInterface
         return this;
     }
 
+    /**
+     * Adds the classes found in a directory to the class map, honoring the
+     * order of the registered extensions
+     */
+    protected function scanDirectory(string! directory, string! prefix, array! classMap) -> array
+    {
+        var className, ds, extension, file, files, fixedDirectory, found,
+            iterator, paths, relative;
+
+        let ds             = DIRECTORY_SEPARATOR,
+            fixedDirectory = rtrim(directory, ds) . ds,
+            found          = [];
+
+        if !is_dir(fixedDirectory) {
+            return classMap;
+        }
+
+        let iterator = new RecursiveIteratorIterator(
+            new RecursiveDirectoryIterator(
+                fixedDirectory,
+                FilesystemIterator::SKIP_DOTS
+            )
+        );
+
+        for file in iterator {
+            if !file->isFile() {
+                continue;
+            }
+
+            let extension = file->getExtension();
+
+            if !in_array(extension, this->extensions, true) {
+                continue;
+            }
+
+            let relative  = substr(file->getPathname(), strlen(fixedDirectory)),
+                className = prefix . str_replace(
+                    ds,
+                    "\\",
+                    substr(relative, 0, -1 - strlen(extension))
+                );
+
+            if !preg_match("/^[a-zA-Z_\\x80-\\xff][a-zA-Z0-9_\\x80-\\xff]*(\\\\[a-zA-Z_\\x80-\\xff][a-zA-Z0-9_\\x80-\\xff]*)*$/", className) {
+                continue;
+            }
+
+            let found[className][extension] = fixedDirectory . relative;
+        }
+
+        for className, files in found {
+            if isset classMap[className] {
+                continue;
+            }
+
+            for extension in this->extensions {
+                if fetch paths, files[extension] {
+                    let classMap[className] = paths;
+
+                    break;
+                }
+            }
+        }
+
+        return classMap;
+    }
+
     protected function prepareNamespace(array! namespaceName) -> array
     {
         var localPaths, name, paths, prepared;
@@ -11,6 +11,7 @@ namespace Phalcon\Mvc;
 
 use JsonSerializable;
 use Phalcon\Db\Adapter\AdapterInterface;
+use Phalcon\Db\Adapter\Pool;
 use Phalcon\Db\Column;
 use Phalcon\Db\DialectInterface;
 use Phalcon\Db\Enum;
@@ -26,6 +27,7 @@ use Phalcon\Mvc\Model\BehaviorInterface;
 use Phalcon\Mvc\Model\Criteria;
 use Phalcon\Mvc\Model\CriteriaInterface;
 use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\MetaDataInterface;
 use Phalcon\Mvc\Model\Query;
@@ -119,10 +121,32 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     protected oldSnapshot = [];
 
+    /**
+     * Operation requested through create(), update() or upsert(), so that
+     * save() does not check again whether the record exists
+     *
+     * @var string|null
+     */
+    protected saveIntent = null;
+
     protected skipped;
 
     protected snapshot;
 
+    /**
+     * Column map of the hydrated row the snapshot is built from
+     */
+    protected snapshotColumnMap = null;
+
+    /**
+     * Hydrated row the snapshot is built from when it is first used. Rows
+     * of models with a column map are kept as they are instead of being
+     * copied into the snapshot and the old snapshot on every hydration.
+     *
+     * @var array|null
+     */
+    protected snapshotRow = null;
+
     protected transaction { get };
 
     protected uniqueKey;
@@ -686,6 +710,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     /**
      * Assigns values to a model from an array returning a new model
      *
+     * Records hydrated as persistent (the default) from data that is known
+     * to be stored, for instance a cached row, are saved without checking
+     * whether they exist. Their snapshot is taken from the data when the
+     * model keeps snapshots.
+     *
      *```php
      * $robot = Phalcon\Mvc\Model::cloneResult(
      *     new Robots(),
@@ -721,6 +750,12 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             let instance->{key} = value;
         }
 
+        if dirtyState === self::DIRTY_STATE_PERSISTENT {
+            if (<ManagerInterface> instance->getModelsManager())->isKeepingSnapshots(instance) {
+                instance->setSnapshotData(data);
+            }
+        }
+
         /**
          * Call afterFetch, this allows the developer to execute actions after a
          * record is fetched from the database
@@ -730,6 +765,81 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return instance;
     }
 
+    /**
+     * Assigns a row to a model through a hydrator compiled with
+     * `compileHydrator()`, returning a new model. The column map and the
+     * types are already resolved in the hydrator, so each row is a single
+     * pass over its columns.
+     *
+     *```php
+     * $hydrator = \Phalcon\Mvc\Model::compileHydrator($columnMap, $row);
+     *
+     * foreach ($rows as $row) {
+     *     $robot = \Phalcon\Mvc\Model::cloneResultHydrator(
+     *         $base,
+     *         $row,
+     *         $hydrator,
+     *         $columnMap
+     *     );
+     * }
+     *```
+     *
+     * @param \Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\Model\Row base
+     * @param array columnMap
+     */
+    public static function cloneResultHydrator(var base, array! data, array! hydrator, var columnMap, int dirtyState = 0, bool keepSnapshots = false) -> <ModelInterface>
+    {
+        var instance, slot, key, attribute, cast, value;
+
+        let instance = clone base;
+
+        instance->setDirtyState(dirtyState);
+
+        for slot in hydrator {
+            let key = slot[0];
+
+            if !fetch value, data[key] {
+                continue;
+            }
+
+            let attribute = slot[1],
+                cast = slot[2];
+
+            if cast === 0 {
+                let instance->{attribute} = value;
+
+                continue;
+            }
+
+            if value == "" || value === null {
+                let value = null;
+            } elseif cast === 1 {
+                let value = intval(value, 10);
+            } elseif cast === 2 {
+                let value = doubleval(value);
+            } else {
+                let value = (bool) value;
+            }
+
+            let instance->{attribute} = value,
+                data[key] = value;
+        }
+
+        if keepSnapshots {
+            instance->keepSnapshotRow(data, columnMap);
+        }
+
+        /**
+         * Call afterFetch, this allows the developer to execute actions after a
+         * record is fetched from the database
+         */
+        if method_exists(instance, "fireEvent") {
+            instance->{"fireEvent"}("afterFetch");
+        }
+
+        return instance;
+    }
+
     /**
      * Assigns values to a model from an array, returning a new model.
      *
@@ -854,8 +964,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          * Models that keep snapshots store the original data in t
          */
         if keepSnapshots {
-            instance->setSnapshotData(data, columnMap);
-            instance->setOldSnapshotData(data, columnMap);
+            instance->keepSnapshotRow(data, columnMap);
         }
 
         /**
@@ -941,6 +1050,92 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return hydrateArray;
     }
 
+    /**
+     * Compiles the hydrator used by `cloneResultHydrator()` for the columns of
+     * a row. Each slot holds the column, the attribute it is assigned to and
+     * how the value is cast (0: as is, 1: integer, 2: float, 3: boolean).
+     * Rows with the same columns (the rows of a resultset) share the
+     * hydrator.
+     *
+     * @param array columnMap
+     */
+    public static function compileHydrator(var columnMap, array! row) -> array
+    {
+        var key, value, attribute, reverseMap;
+        array hydrator;
+
+        let hydrator = [],
+            reverseMap = null;
+
+        for key, value in row {
+            // Only string keys in the data are valid
+            if typeof key !== "string" {
+                continue;
+            }
+
+            if typeof columnMap != "array" {
+                let hydrator[] = [key, key, 0];
+
+                continue;
+            }
+
+            // Every field must be part of the column map
+            if !fetch attribute, columnMap[key] {
+                if !empty columnMap {
+                    if reverseMap === null {
+                        let reverseMap = array_flip(columnMap);
+                    }
+
+                    if fetch attribute, reverseMap[key] {
+                        let hydrator[] = [key, attribute, 0];
+
+                        continue;
+                    }
+                }
+
+                if unlikely !globals_get("orm.ignore_unknown_columns") {
+                    throw new Exception(
+                        "Column '" . key . "' doesn't make part of the column map"
+                    );
+                }
+
+                continue;
+            }
+
+            if typeof attribute != "array" {
+                let hydrator[] = [key, attribute, 0];
+
+                continue;
+            }
+
+            switch attribute[1] {
+                case Column::TYPE_BIGINTEGER:
+                case Column::TYPE_INTEGER:
+                case Column::TYPE_MEDIUMINTEGER:
+                case Column::TYPE_SMALLINTEGER:
+                case Column::TYPE_TINYINTEGER:
+                    let hydrator[] = [key, attribute[0], 1];
+                    break;
+
+                case Column::TYPE_DECIMAL:
+                case Column::TYPE_DOUBLE:
+                case Column::TYPE_FLOAT:
+                    let hydrator[] = [key, attribute[0], 2];
+                    break;
+
+                case Column::TYPE_BOOLEAN:
+                    let hydrator[] = [key, attribute[0], 3];
+                    break;
+
+                default:
+                    let hydrator[] = [key, attribute[0], 0];
+                    break;
+            }
+        }
+
+        return hydrator;
+    }
+
     /**
      * Counts how many records match the specified conditions
      *
@@ -1005,28 +1200,33 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     {
         var metaData;
 
-        let metaData = this->getModelsMetaData();
-
         /**
-         * Get the current connection use write to prevent replica lag
-         * If the record already exists we must throw an exception
+         * With explicit intent the database reports duplicated keys instead
          */
-        if this->_exists(metaData, this->getWriteConnection()) {
-            let this->errorMessages = [
-                new Message(
-                    "Record cannot be created because it already exists",
-                    null,
-                    "InvalidCreateAttempt"
-                )
-            ];
+        if !globals_get("orm.explicit_intent") {
+            let metaData = this->getModelsMetaData();
 
-            return false;
+            /**
+             * Get the current connection use write to prevent replica lag
+             * If the record already exists we must throw an exception
+             */
+            if this->_exists(metaData, this->getWriteConnection()) {
+                let this->errorMessages = [
+                    new Message(
+                        "Record cannot be created because it already exists",
+                        null,
+                        "InvalidCreateAttempt"
+                    )
+                ];
+
+                return false;
+            }
         }
 
         /**
-         * Using save() anyways
+         * Using save() anyways, without checking again
          */
-        return this->save();
+        return this->saveWithIntent("create");
     }
 
     /**
@@ -1189,6 +1389,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             }
         }
 
+        if success {
+            this->removeFromIdentityMap();
+            this->invalidateCacheTag();
+        }
+
         /**
          * Force perform the record existence checking again
          */
@@ -1508,7 +1713,9 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public static function findFirst(var parameters = null) -> <ModelInterface> | bool
     {
-        var params, query;
+        var manager, params, query, record;
+
+        let manager = null;
 
         if null === parameters {
             let params = [];
@@ -1516,6 +1723,26 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             let params = parameters;
         } elseif typeof parameters === "string" || is_numeric(parameters) {
             let params = [parameters];
+
+            /**
+             * Primary key lookups are served from the identity map
+             */
+            if is_numeric(parameters) {
+                let manager = Di::getDefault()->getShared("modelsManager");
+
+                if manager instanceof Manager && manager->isUsingIdentityMap() {
+                    let record = manager->getIdentityMapRecord(
+                        get_called_class(),
+                        parameters
+                    );
+
+                    if record !== null {
+                        return record;
+                    }
+                } else {
+                    let manager = null;
+                }
+            }
         } else {
             throw new Exception(
                 "Parameters passed must be of type array, string, numeric or null"
@@ -1532,7 +1759,13 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * Execute the query passing the bind-params and casting-types
          */
-        return query->execute();
+        let record = query->execute();
+
+        if manager !== null && typeof record === "object" {
+            manager->setIdentityMapRecord(record);
+        }
+
+        return record;
     }
 
     /**
@@ -1600,6 +1833,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         var metaData, name, snapshot, columnMap, allAttributes, value;
         array changed;
 
+        this->buildSnapshot();
+
         let snapshot = this->snapshot;
 
         if unlikely typeof snapshot != "array" {
@@ -1780,6 +2015,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public function getOldSnapshotData() -> array
     {
+        this->buildSnapshot();
+
         return this->oldSnapshot;
     }
 
@@ -1906,6 +2143,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public function getSnapshotData() -> array
     {
+        this->buildSnapshot();
+
         return this->snapshot;
     }
 
@@ -1938,6 +2177,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         var name, snapshot, oldSnapshot, value;
         array updated;
 
+        this->buildSnapshot();
+
         let snapshot = this->snapshot;
         let oldSnapshot = this->oldSnapshot;
 
@@ -2056,7 +2297,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public function hasSnapshotData() -> bool
     {
-        return typeof this->snapshot == "array";
+        return this->snapshotRow !== null || typeof this->snapshot == "array";
     }
 
     /**
@@ -2306,8 +2547,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             this->assign(row, null, columnMap);
 
             if manager->isKeepingSnapshots(this) {
-                this->setSnapshotData(row, columnMap);
-                this->setOldSnapshotData(row, columnMap);
+                this->keepSnapshotRow(row, columnMap);
             }
         }
 
@@ -2341,10 +2581,11 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     public function save() -> bool
     {
         var metaData, schema, writeConnection, readConnection, source, table,
-            identityField, exists, success, dirtyRelated;
+            identityField, exists, success, dirtyRelated, intent;
         bool hasDirtyRelated;
 
-        let metaData = this->getModelsMetaData();
+        let metaData = this->getModelsMetaData(),
+            intent   = this->saveIntent;
 
         /**
          * Create/Get the current database connection
@@ -2387,9 +2628,35 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         let readConnection = this->getReadConnection();
 
         /**
-         * We need to check if the record exists
+         * We need to check if the record exists, unless the operation has
+         * been requested explicitly. For updates _exists() only builds the
+         * primary key condition.
          */
-        let exists = this->_exists(metaData, readConnection);
+        if intent === null {
+            let exists = this->_exists(metaData, readConnection);
+        } elseif intent === "update" {
+            let this->dirtyState = self::DIRTY_STATE_PERSISTENT,
+                exists           = this->_exists(metaData, readConnection);
+
+            if unlikely !exists {
+                if hasDirtyRelated {
+                    writeConnection->rollback(false);
+                }
+
+                let this->errorMessages = [
+                    new Message(
+                        "Record cannot be updated because it does not exist",
+                        null,
+                        "InvalidUpdateAttempt"
+                    )
+                ];
+
+                return false;
+            }
+        } else {
+            let this->dirtyState = self::DIRTY_STATE_TRANSIENT,
+                exists           = false;
+        }
 
         if exists {
             let this->operationMade = self::OP_UPDATE;
@@ -2490,6 +2757,9 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                 let this->dirtyRelated = [];
             }
 
+            this->removeFromIdentityMap();
+            this->invalidateCacheTag();
+
             this->fireEvent("afterSave");
         }
 
@@ -2512,6 +2782,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             manager = <ManagerInterface> this->getModelsManager();
 
         if manager->isKeepingSnapshots(this) {
+            this->buildSnapshot();
+
             let snapshot = this->snapshot;
 
             /**
@@ -2650,6 +2922,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         var key, value, attribute;
         array snapshot;
 
+        this->buildSnapshot();
+
         /**
          * Build the snapshot based on a column map
          */
@@ -2710,6 +2984,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         var key, value, attribute;
         array snapshot;
 
+        this->buildSnapshot();
+
         /**
          * Build the snapshot based on a column map
          */
@@ -2819,7 +3095,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             exceptionOnFailedSave, exceptionOnFailedMetaDataSave, phqlLiterals,
             virtualForeignKeys, lateStateBinding, castOnHydrate,
             ignoreUnknownColumns, updateSnapshotOnSave, disableAssignSetters,
-            caseInsensitiveColumnMap, prefetchRecords, lastInsertId;
+            caseInsensitiveColumnMap, prefetchRecords, lastInsertId,
+            explicitIntent;
 
         /**
          * Enables/Disables globally the internal events
@@ -2914,6 +3191,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         if fetch lastInsertId, options["castLastInsertIdToInt"] {
             globals_set("orm.cast_last_insert_id_to_int", lastInsertId);
         }
+
+        /**
+         * create() and update() trust the caller instead of checking whether
+         * the record exists
+         */
+        if fetch explicitIntent, options["explicitIntent"] {
+            globals_set("orm.explicit_intent", explicitIntent);
+        }
     }
 
     /**
@@ -3051,8 +3336,9 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
 
         /**
          * We don't check if the record exists if the record is already checked
+         * or if the caller states that it exists
          */
-        if this->dirtyState {
+        if this->dirtyState && !globals_get("orm.explicit_intent") {
             let metaData = this->getModelsMetaData();
 
             if !this->_exists(metaData, this->getReadConnection()) {
@@ -3071,7 +3357,28 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * Call save() anyways
          */
-        return this->save();
+        return this->saveWithIntent("update");
+    }
+
+    /**
+     * Inserts the record or, if a record with the same primary key already
+     * exists, updates it, in a single statement (`INSERT ... ON DUPLICATE KEY
+     * UPDATE` on MySQL, `INSERT ... ON CONFLICT` on PostgreSQL and SQLite).
+     * No query is made to check whether the record exists; the create
+     * validations and events are used.
+     *
+     *```php
+     * $robot = new Robots();
+     *
+     * $robot->id   = 100;
+     * $robot->name = "Biomass";
+     *
+     * $robot->upsert();
+     *```
+     */
+    public function upsert() -> bool
+    {
+        return this->saveWithIntent("upsert");
     }
 
     /**
@@ -3511,7 +3818,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             bindSkip, bindType, bindTypes, columnMap, defaultValue, defaultValues,
             field, fields, lastInsertedId, manager, sequenceName, schema,
             snapshot, source, success, unsetDefaultValues, value, values;
-        bool useExplicitIdentity;
+        bool hasIdentityValue = false, isUpsert, useExplicitIdentity;
 
         let bindSkip            = Column::BIND_SKIP,
             manager             = <ManagerInterface> this->modelsManager,
@@ -3643,6 +3950,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                         let fields[] = identityField;
                     }
 
+                    let hasIdentityValue = true;
+
                     /**
                      * The field is valid we look for a bind value (normally int)
                      */
@@ -3671,11 +3980,31 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
          }
 
         /**
-         * The low level insert is performed
+         * The low level insert is performed. Upserts update the row with the
+         * same primary key instead of failing.
          */
-        let success = connection->insert(table, values, fields, bindTypes);
+        let isUpsert = this->saveIntent === "upsert";
 
-        if success && identityField !== false {
+        if isUpsert {
+            if unlikely !method_exists(connection, "upsert") {
+                throw new Exception("The connection does not support upserts");
+            }
+
+            let success = connection->{"upsert"}(
+                table,
+                values,
+                fields,
+                metaData->getPrimaryKeyAttributes(this),
+                bindTypes
+            );
+        } else {
+            let success = connection->insert(table, values, fields, bindTypes);
+        }
+
+        /**
+         * An upserted row that already existed has no new identity
+         */
+        if success && identityField !== false && !(isUpsert && hasIdentityValue) {
             /**
              * We check if the model have sequences
              */
@@ -3729,7 +4058,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             }
 
             if manager->isKeepingSnapshots(this) && globals_get("orm.update_snapshot_on_save") {
-                let this->snapshot = snapshot;
+                let this->snapshot    = snapshot,
+                    this->snapshotRow = null;
             }
         }
 
@@ -3759,6 +4089,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         /**
          * Check if the model must use dynamic update
          */
+        this->buildSnapshot();
+
         let useDynamicUpdate = (bool) manager->isUsingDynamicUpdate(this),
             snapshot         = this->snapshot;
 
@@ -4126,6 +4458,14 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             let table = source;
         }
 
+        /**
+         * The check decides between an insert and an update: a connection
+         * pool answers it from the primary, as a replica could lag behind
+         */
+        if connection instanceof Pool {
+            let connection = connection->getPrimary();
+        }
+
         /**
          * Here we use a single COUNT(*) without PHQL to make the execution
          * faster
@@ -5158,6 +5498,105 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         );
     }
 
+    /**
+     * Builds the snapshot and the old snapshot from the hydrated row, the
+     * first time they are needed
+     */
+    private function buildSnapshot() -> void
+    {
+        var row;
+
+        let row = this->snapshotRow;
+
+        if row === null {
+            return;
+        }
+
+        let this->snapshotRow = null;
+
+        this->setSnapshotData(row, this->snapshotColumnMap);
+
+        let this->oldSnapshot       = this->snapshot,
+            this->snapshotColumnMap = null;
+    }
+
+    /**
+     * Keeps the hydrated row as the snapshot and the old snapshot. Rows
+     * without a column map are shared as they are; rows with a column map
+     * are only renamed when the snapshot is used.
+     */
+    private function keepSnapshotRow(array data, var columnMap) -> void
+    {
+        if typeof columnMap != "array" {
+            let this->snapshot    = data,
+                this->oldSnapshot = data,
+                this->snapshotRow = null;
+
+            return;
+        }
+
+        let this->snapshotRow       = data,
+            this->snapshotColumnMap = columnMap;
+    }
+
+    /**
+     * Saves the record for an operation requested explicitly
+     */
+    private function saveWithIntent(string intent) -> bool
+    {
+        var e, success;
+
+        let this->saveIntent = intent;
+
+        try {
+            let success = this->save();
+        } catch \Throwable, e {
+            let this->saveIntent = null;
+
+            throw e;
+        }
+
+        let this->saveIntent = null;
+
+        return success;
+    }
+
+    /**
+     * Gives the table of the model a new cache tag version once a record has
+     * been saved or deleted, when the models manager uses cache tags. Under
+     * a transaction, the version only changes once it has been committed.
+     */
+    private function invalidateCacheTag() -> void
+    {
+        var manager;
+
+        let manager = this->modelsManager;
+
+        if manager instanceof Manager && manager->isUsingCacheTags() {
+            manager->invalidateCacheTags(
+                [
+                    manager->getCacheTag(this)
+                ],
+                this->getWriteConnection()
+            );
+        }
+    }
+
+    /**
+     * Removes the record from the identity map of the models manager once
+     * it has been saved or deleted
+     */
+    private function removeFromIdentityMap() -> void
+    {
+        var manager;
+
+        let manager = this->modelsManager;
+
+        if manager instanceof Manager && manager->isUsingIdentityMap() {
+            manager->removeIdentityMapRecord(this);
+        }
+    }
+
     /**
      * shared prepare query logic for find and findFirst method
      */
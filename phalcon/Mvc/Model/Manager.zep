@@ -68,6 +68,44 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected belongsToSingle = [];
 
+    /**
+     * Connections with cache tags deferred until their transaction ends, by
+     * object hash
+     *
+     * @var array
+     */
+    protected cacheTagsConnections = [];
+
+    /**
+     * Cache tags invalidated under a transaction, by object hash of its
+     * connection
+     *
+     * @var array
+     */
+    protected cacheTagsDeferred = [];
+
+    /**
+     * Number of holdCacheTags() calls not released yet
+     *
+     * @var int
+     */
+    protected cacheTagsHeld = 0;
+
+    /**
+     * Cache tags invalidated while they were held
+     *
+     * @var array
+     */
+    protected cacheTagsPending = [];
+
+    /**
+     * Cache service holding the versions of the cache tags, null when the
+     * query cache is not tagged
+     *
+     * @var string|null
+     */
+    protected cacheTagsService = null;
+
     protected container;
 
     protected customEventsManager = [];
@@ -119,6 +157,35 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected hasOneThroughSingle = [];
 
+    /**
+     * Records loaded by primary key, per model (first level cache)
+     *
+     * @var array
+     */
+    protected identityMap = [];
+
+    /**
+     * @var bool
+     */
+    protected identityMapEnabled = false;
+
+    /**
+     * @var int
+     */
+    protected identityMapHits = 0;
+
+    /**
+     * Primary key attributes of the models in the identity map
+     *
+     * @var array
+     */
+    protected identityMapKeys = [];
+
+    /**
+     * @var int
+     */
+    protected identityMapMisses = 0;
+
     /**
      * Mark initialized models
      */
@@ -1398,7 +1465,7 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         var referencedModel, intermediateModel, intermediateFields, fields,
             builder, extraParameters, refPosition, field, referencedFields,
             findParams, findArguments, uniqueKey, records, arguments, rows,
-            firstRow, query;
+            firstRow, query, identityKey, identityKeys;
         array placeholders, conditions, joinConditions;
         bool reusable;
         string retrieveMethod;
@@ -1565,6 +1632,32 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
             let retrieveMethod = method;
         }
 
+        /**
+         * belongsTo records referenced by their primary key are served from
+         * the identity map
+         */
+        let identityKey = null;
+
+        if this->identityMapEnabled && method === null && parameters === null && empty extraParameters && typeof fields != "array" && relation->getType() === Relation::BELONGS_TO {
+            if !fetch identityKeys, this->identityMapKeys[strtolower(referencedModel)] {
+                let identityKeys = this->getIdentityMapKeys(
+                    this->load(referencedModel)
+                );
+            }
+
+            if identityKeys === [referencedFields] {
+                let identityKey = record->readAttribute(fields);
+
+                if identityKey !== null {
+                    let records = this->getIdentityMapRecord(referencedModel, identityKey);
+
+                    if records !== null {
+                        return records;
+                    }
+                }
+            }
+        }
+
         /**
          * Find first results could be reusable
          */
@@ -1600,6 +1693,10 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
             this->setReusableRecords(referencedModel, uniqueKey, records);
         }
 
+        if identityKey !== null && typeof records == "object" {
+            this->setIdentityMapRecord(records);
+        }
+
         return records;
     }
 
@@ -1633,6 +1730,379 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->reusable = [];
     }
 
+    /**
+     * Invalidates the cache tags deferred under a transaction of the
+     * connection, once it has been committed
+     */
+    public function commitCacheTags(<AdapterInterface> connection) -> void
+    {
+        var hash, tags;
+
+        if connection->isUnderTransaction() {
+            return;
+        }
+
+        let hash = spl_object_hash(connection);
+
+        if !fetch tags, this->cacheTagsDeferred[hash] {
+            return;
+        }
+
+        unset this->cacheTagsDeferred[hash];
+        unset this->cacheTagsConnections[hash];
+
+        this->invalidateCacheTags(
+            array_keys(tags)
+        );
+    }
+
+    /**
+     * Returns the cache tag of a model: its table, with the schema
+     */
+    public function getCacheTag(<ModelInterface> model) -> string
+    {
+        var schema;
+
+        let schema = model->getSchema();
+
+        if empty schema {
+            return model->getSource();
+        }
+
+        return schema . "." . model->getSource();
+    }
+
+    /**
+     * Returns the current version of each cache tag. Tags without a version
+     * (never invalidated or evicted from the cache) get a new one.
+     */
+    public function getCacheTagVersions(array tags) -> array
+    {
+        var cache, key, tag, version;
+        array versions;
+
+        this->commitEndedCacheTags();
+
+        let cache    = this->getCacheTagsCache(),
+            versions = [];
+
+        sort(tags);
+
+        for tag in tags {
+            let key     = this->getCacheTagKey(tag),
+                version = cache->get(key);
+
+            if empty version {
+                let version = uniqid("", true);
+
+                cache->set(key, version);
+            }
+
+            let versions[tag] = version;
+        }
+
+        return versions;
+    }
+
+    /**
+     * Defers the invalidation of cache tags until releaseCacheTags(), for
+     * instance while the records of a PHQL UPDATE are saved one by one
+     */
+    public function holdCacheTags() -> void
+    {
+        let this->cacheTagsHeld++;
+    }
+
+    /**
+     * Invalidates the query results cached for some tables by giving their
+     * tags a new version. When the connection that changed the tables is
+     * under a transaction, the tags are only invalidated once it has been
+     * committed (see commitCacheTags()/rollbackCacheTags()), so that other
+     * requests never cache the data that was visible before the commit.
+     *
+     * ```php
+     * $modelsManager->invalidateCacheTags(["robots"]);
+     * ```
+     */
+    public function invalidateCacheTags(array tags, <AdapterInterface> connection = null) -> void
+    {
+        var cache, hash, tag;
+
+        if connection !== null && connection->isUnderTransaction() {
+            let hash = spl_object_hash(connection);
+
+            let this->cacheTagsConnections[hash] = connection;
+
+            for tag in tags {
+                let this->cacheTagsDeferred[hash][tag] = true;
+            }
+
+            return;
+        }
+
+        if this->cacheTagsHeld > 0 {
+            for tag in tags {
+                let this->cacheTagsPending[tag] = true;
+            }
+
+            return;
+        }
+
+        let cache = this->getCacheTagsCache();
+
+        for tag in tags {
+            cache->set(
+                this->getCacheTagKey(tag),
+                uniqid("", true)
+            );
+        }
+    }
+
+    /**
+     * Checks if the keys of the cached queries are tagged with the versions
+     * of their tables
+     */
+    public function isUsingCacheTags() -> bool
+    {
+        return this->cacheTagsService !== null;
+    }
+
+    /**
+     * Releases a holdCacheTags() call, invalidating the tags collected in the
+     * meantime once every hold has been released
+     */
+    public function releaseCacheTags() -> void
+    {
+        var pending;
+
+        if this->cacheTagsHeld > 0 {
+            let this->cacheTagsHeld--;
+        }
+
+        if this->cacheTagsHeld > 0 || empty this->cacheTagsPending {
+            return;
+        }
+
+        let pending                = array_keys(this->cacheTagsPending),
+            this->cacheTagsPending = [];
+
+        this->invalidateCacheTags(pending);
+    }
+
+    /**
+     * Discards the cache tags deferred under a transaction of the connection,
+     * once it has been rolled back
+     */
+    public function rollbackCacheTags(<AdapterInterface> connection) -> void
+    {
+        var hash;
+
+        if connection->isUnderTransaction() {
+            return;
+        }
+
+        let hash = spl_object_hash(connection);
+
+        unset this->cacheTagsDeferred[hash];
+        unset this->cacheTagsConnections[hash];
+    }
+
+    /**
+     * Enables or disables tagged query caching. When enabled, the results
+     * cached without an explicit key (`cache(["lifetime" => 300])`) are
+     * stored under a key that contains the versions of their tables, and
+     * saving or deleting a record, or running a PHQL UPDATE/DELETE, gives
+     * the tables a new version, so that stale results are never read again.
+     * The versions are stored in the given cache service.
+     *
+     * ```php
+     * $modelsManager->useCacheTags(true);
+     *
+     * $robots = Robots::find(
+     *     [
+     *         "type = 'mechanical'",
+     *         "cache" => [
+     *             "lifetime" => 3600,
+     *         ],
+     *     ]
+     * );
+     * ```
+     */
+    public function useCacheTags(bool enabled, string! service = "modelsCache") -> void
+    {
+        if enabled {
+            let this->cacheTagsService = service;
+        } else {
+            let this->cacheTagsService     = null,
+                this->cacheTagsConnections = [],
+                this->cacheTagsDeferred    = [],
+                this->cacheTagsHeld        = 0,
+                this->cacheTagsPending     = [];
+        }
+    }
+
+    /**
+     * Removes the records of a model, or of every model, from the identity
+     * map
+     */
+    public function clearIdentityMap(string modelName = null) -> void
+    {
+        if modelName === null {
+            let this->identityMap = [];
+
+            return;
+        }
+
+        unset this->identityMap[strtolower(modelName)];
+    }
+
+    /**
+     * Returns the record of a model with the given primary key from the
+     * identity map or null if it has not been loaded yet
+     *
+     * ```php
+     * $robot = $modelsManager->getIdentityMapRecord(Robots::class, 42);
+     * ```
+     */
+    public function getIdentityMapRecord(string! modelName, var key) -> <ModelInterface> | null
+    {
+        var entityName, record, records;
+
+        let entityName = strtolower(modelName),
+            key        = (string) key;
+
+        if fetch records, this->identityMap[entityName] {
+            if fetch record, records[key] {
+                /**
+                 * A record whose primary key changed is stale under its old
+                 * key
+                 */
+                if likely this->getIdentityMapKey(record) === key {
+                    let this->identityMapHits++;
+
+                    return record;
+                }
+
+                /**
+                 * Release the map's copy first so that the unset does not
+                 * duplicate the records
+                 */
+                let this->identityMap[entityName] = null;
+
+                unset records[key];
+
+                let this->identityMap[entityName] = records;
+            }
+        }
+
+        let this->identityMapMisses++;
+
+        return null;
+    }
+
+    /**
+     * Returns the hits, misses and number of records of the identity map
+     */
+    public function getIdentityMapStats() -> array
+    {
+        var records;
+        int size = 0;
+
+        for records in this->identityMap {
+            let size += count(records);
+        }
+
+        return [
+            "hits"    : this->identityMapHits,
+            "misses"  : this->identityMapMisses,
+            "records" : size
+        ];
+    }
+
+    /**
+     * Checks if primary key finds and belongsTo relations are served from
+     * the identity map
+     */
+    public function isUsingIdentityMap() -> bool
+    {
+        return this->identityMapEnabled;
+    }
+
+    /**
+     * Removes a record from the identity map, for instance after it has been
+     * saved or deleted. A record stored under a primary key that has changed
+     * since is dropped by getIdentityMapRecord().
+     */
+    public function removeIdentityMapRecord(<ModelInterface> model) -> void
+    {
+        var entityName, key, records;
+
+        let key = this->getIdentityMapKey(model);
+
+        if key === null {
+            return;
+        }
+
+        let entityName = get_class_lower(model);
+
+        if fetch records, this->identityMap[entityName] {
+            /**
+             * Release the map's copy first so that the unset does not
+             * duplicate the records
+             */
+            let this->identityMap[entityName] = null;
+
+            unset records[key];
+
+            let this->identityMap[entityName] = records;
+        }
+    }
+
+    /**
+     * Stores a record in the identity map, under its primary key. Returns
+     * false if the primary key of the record is not complete.
+     */
+    public function setIdentityMapRecord(<ModelInterface> model) -> bool
+    {
+        var entityName, key;
+
+        let key = this->getIdentityMapKey(model);
+
+        if key === null {
+            return false;
+        }
+
+        let entityName = get_class_lower(model),
+            this->identityMap[entityName][key] = model;
+
+        return true;
+    }
+
+    /**
+     * Enables or disables the identity map, a per request cache of the
+     * records loaded by primary key. When enabled, `findFirst()` with a
+     * primary key value and `belongsTo` relations return the record already
+     * loaded instead of querying the database again. Records are removed
+     * from the map when they are saved or deleted.
+     *
+     * ```php
+     * $modelsManager->useIdentityMap(true);
+     *
+     * $robot = Robots::findFirst(42);
+     *
+     * // No query, same object
+     * $robot === Robots::findFirst(42);
+     * ```
+     */
+    public function useIdentityMap(bool enabled) -> void
+    {
+        let this->identityMapEnabled = enabled;
+
+        if !enabled {
+            let this->identityMap = [];
+        }
+    }
+
     /**
      * Gets belongsTo related records from a model
      */
@@ -2007,11 +2477,133 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return this->lastQuery;
     }
 
+    /**
+     * Returns the key of the version of a cache tag in the cache
+     */
+    protected function getCacheTagKey(string tag) -> string
+    {
+        return "phql-tag-" . preg_replace("/[^A-Za-z0-9_.-]/", "_", tag);
+    }
+
+    /**
+     * Returns the cache service holding the versions of the cache tags
+     */
+    protected function getCacheTagsCache() -> var
+    {
+        var cache, container;
+
+        let container = this->container;
+
+        if unlikely typeof container != "object" {
+            throw new Exception(
+                Exception::containerServiceNotFound(
+                    "the services related to the ORM"
+                )
+            );
+        }
+
+        let cache = container->getShared(this->cacheTagsService);
+
+        if unlikely typeof cache != "object" {
+            throw new Exception("Cache service must be an object");
+        }
+
+        return cache;
+    }
+
+    /**
+     * Returns the identity map key of a record, or null if a primary key
+     * value is missing
+     */
+    protected function getIdentityMapKey(<ModelInterface> model) -> string | null
+    {
+        var attribute, value;
+        array values;
+
+        let values = [];
+
+        for attribute in this->getIdentityMapKeys(model) {
+            let value = model->readAttribute(attribute);
+
+            if value === null {
+                return null;
+            }
+
+            let values[] = (string) value;
+        }
+
+        if empty values {
+            return null;
+        }
+
+        return join(chr(0), values);
+    }
+
+    /**
+     * Returns the primary key attributes of a model, renamed by its column
+     * map
+     */
+    protected function getIdentityMapKeys(<ModelInterface> model) -> array
+    {
+        var attribute, columnMap, entityName, keys, metaData, renamed;
+
+        let entityName = get_class_lower(model);
+
+        if fetch keys, this->identityMapKeys[entityName] {
+            return keys;
+        }
+
+        let metaData  = model->getModelsMetaData(),
+            columnMap = null,
+            keys      = [];
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(model);
+        }
+
+        for attribute in metaData->getPrimaryKeyAttributes(model) {
+            if typeof columnMap === "array" {
+                if fetch renamed, columnMap[attribute] {
+                    let attribute = renamed;
+                }
+            }
+
+            let keys[] = attribute;
+        }
+
+        let this->identityMapKeys[entityName] = keys;
+
+        return keys;
+    }
+
+    /**
+     * Commits the cache tags deferred under the transactions that have ended
+     * without going through commitCacheTags(), for instance when
+     * `$connection->commit()` was called directly. A rollback cannot be told
+     * apart from a commit there, so the tags are invalidated in both cases.
+     */
+    private function commitEndedCacheTags() -> void
+    {
+        var connection, connections;
+
+        let connections = this->cacheTagsConnections;
+
+        for connection in connections {
+            if !connection->isUnderTransaction() {
+                this->commitCacheTags(connection);
+            }
+        }
+    }
+
     /**
      * Destroys the current PHQL cache
      */
     public function __destruct()
     {
+        if this->cacheTagsService !== null && !empty this->cacheTagsConnections {
+            this->commitEndedCacheTags();
+        }
+
         phalcon_orm_destroy_cache();
 
         Query::clean();
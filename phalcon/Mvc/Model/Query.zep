@@ -97,6 +97,12 @@ class Query implements QueryInterface, InjectionAwareInterface
     protected modelsInstances;
     protected nestingLevel = -1;
     protected phql;
+
+    /**
+     * Result fetched by executeParallel() for the next execution
+     */
+    protected prefetchedResult = null;
+
     protected sharedLock;
     protected sqlAliases;
     protected sqlAliasesModels;
@@ -3064,9 +3070,14 @@ class Query implements QueryInterface, InjectionAwareInterface
         }
 
         /**
-         * Execute the query
+         * Execute the query, unless executeParallel() already did
          */
-        let result = connection->query(sqlSelect, processed, processedTypes);
+        if this->prefetchedResult !== null {
+            let result                 = this->prefetchedResult,
+                this->prefetchedResult = null;
+        } else {
+            let result = connection->query(sqlSelect, processed, processedTypes);
+        }
 
         /**
          * Check if the query has data
@@ -3644,22 +3655,54 @@ class Query implements QueryInterface, InjectionAwareInterface
     {
         var uniqueRow, cacheOptions, key, cacheService, cache, result,
             preparedResult, defaultBindParams, mergedParams, defaultBindTypes,
-            mergedTypes, type, lifetime, intermediate;
+            mergedTypes, type, lifetime, intermediate, manager, e, models,
+            model;
+        bool holdsCacheTags;
 
         let uniqueRow    = this->uniqueRow,
             cacheOptions = this->cacheOptions;
 
+        /**
+         * The statement is parsed from its PHQL string or a previously
+         * processed IR
+         */
+        let intermediate = this->parse();
+
+        /**
+         * Check for default bind parameters and merge them with the passed ones
+         */
+        let defaultBindParams = this->bindParams;
+
+        if typeof defaultBindParams == "array" {
+            let mergedParams = defaultBindParams + bindParams;
+        } else {
+            let mergedParams = bindParams;
+        }
+
+        /**
+         * Check for default bind types and merge them with the passed ones
+         */
+        let defaultBindTypes = this->bindTypes;
+
+        if typeof defaultBindTypes == "array" {
+            let mergedTypes = defaultBindTypes + bindTypes;
+        } else {
+            let mergedTypes = bindTypes;
+        }
+
         if cacheOptions !== null {
             if unlikely typeof cacheOptions != "array" {
                 throw new Exception("Invalid caching options");
             }
 
             /**
-             * The user must set a cache key
+             * Without a key, the key is derived from the statement
              */
-            if unlikely !fetch key, cacheOptions["key"] {
-                throw new Exception(
-                    "A cache key must be provided to identify the cached resultset in the cache backend"
+            if !fetch key, cacheOptions["key"] {
+                let key = this->getCacheKey(
+                    intermediate,
+                    mergedParams,
+                    mergedTypes
                 );
             }
 
@@ -3700,75 +3743,90 @@ class Query implements QueryInterface, InjectionAwareInterface
             let this->cache = cache;
         }
 
-        /**
-         * The statement is parsed from its PHQL string or a previously
-         * processed IR
-         */
-        let intermediate = this->parse();
+        let type    = this->type,
+            manager = this->manager;
 
         /**
-         * Check for default bind parameters and merge them with the passed ones
+         * The records of an UPDATE/DELETE are saved one by one; the versions
+         * of the cache tags are only changed once, at the end
          */
-        let defaultBindParams = this->bindParams;
+        let holdsCacheTags = (type == PHQL_T_UPDATE || type == PHQL_T_DELETE) && manager instanceof Manager && manager->isUsingCacheTags();
 
-        if typeof defaultBindParams == "array" {
-            let mergedParams = defaultBindParams + bindParams;
-        } else {
-            let mergedParams = bindParams;
+        if holdsCacheTags {
+            manager->holdCacheTags();
         }
 
-        /**
-         * Check for default bind types and merge them with the passed ones
-         */
-        let defaultBindTypes = this->bindTypes;
+        try {
+            switch type {
+                case PHQL_T_SELECT:
+                    let result = this->_executeSelect(
+                        intermediate,
+                        mergedParams,
+                        mergedTypes
+                    );
 
-        if typeof defaultBindTypes == "array" {
-            let mergedTypes = defaultBindTypes + bindTypes;
-        } else {
-            let mergedTypes = bindTypes;
-        }
+                    break;
 
-        let type = this->type;
+                case PHQL_T_INSERT:
+                    let result = this->_executeInsert(
+                        intermediate,
+                        mergedParams,
+                        mergedTypes
+                    );
 
-        switch type {
-            case PHQL_T_SELECT:
-                let result = this->_executeSelect(
-                    intermediate,
-                    mergedParams,
-                    mergedTypes
-                );
+                    break;
 
-                break;
+                case PHQL_T_UPDATE:
+                    let result = this->_executeUpdate(
+                        intermediate,
+                        mergedParams,
+                        mergedTypes
+                    );
 
-            case PHQL_T_INSERT:
-                let result = this->_executeInsert(
-                    intermediate,
-                    mergedParams,
-                    mergedTypes
-                );
+                    break;
 
-                break;
+                case PHQL_T_DELETE:
+                    let result = this->_executeDelete(
+                        intermediate,
+                        mergedParams,
+                        mergedTypes
+                    );
 
-            case PHQL_T_UPDATE:
-                let result = this->_executeUpdate(
-                    intermediate,
-                    mergedParams,
-                    mergedTypes
-                );
+                    break;
 
-                break;
+                default:
+                    throw new Exception("Unknown statement " . type);
+            }
+        } catch \Throwable, e {
+            if holdsCacheTags {
+                manager->releaseCacheTags();
+            }
 
-            case PHQL_T_DELETE:
-                let result = this->_executeDelete(
+            throw e;
+        }
+
+        if holdsCacheTags {
+            let models = intermediate["models"];
+
+            if !fetch model, this->modelsInstances[models[0]] {
+                let model = manager->load(models[0]);
+            }
+
+            /**
+             * Under a transaction, the tags are only invalidated once it has
+             * been committed
+             */
+            manager->invalidateCacheTags(
+                this->getCacheTags(intermediate),
+                this->getWriteConnection(
+                    model,
                     intermediate,
                     mergedParams,
                     mergedTypes
-                );
-
-                break;
+                )
+            );
 
-            default:
-                throw new Exception("Unknown statement " . type);
+            manager->releaseCacheTags();
         }
 
         /**
@@ -3799,6 +3857,89 @@ class Query implements QueryInterface, InjectionAwareInterface
         return preparedResult;
     }
 
+    /**
+     * Executes several queries, sending the SELECT statements that share a
+     * connection to the database at once (see
+     * `Phalcon\Db\Adapter\AbstractAdapter::queryParallel()`). The results
+     * are returned under the keys of the queries.
+     *
+     * ```php
+     * $results = Query::executeParallel(
+     *     [
+     *         "robots" => $manager->createQuery("SELECT * FROM Robots"),
+     *         "parts"  => $manager->createQuery("SELECT * FROM Parts"),
+     *     ]
+     * );
+     * ```
+     */
+    public static function executeParallel(array queries) -> array
+    {
+        var key, query, prepared, connection, hash, group, result, e;
+        array connections, groups, prefetched, results;
+
+        let connections = [],
+            groups      = [];
+
+        for key, query in queries {
+            if unlikely !(query instanceof Query) {
+                throw new Exception(
+                    "Only Phalcon\\Mvc\\Model\\Query instances can be executed in parallel"
+                );
+            }
+
+            let prepared = query->prepareParallel();
+
+            if prepared === null {
+                continue;
+            }
+
+            let connection        = prepared[0],
+                hash              = spl_object_hash(connection),
+                connections[hash] = connection,
+                groups[hash][key] = [prepared[1], prepared[2], prepared[3]];
+        }
+
+        /**
+         * The results are handed to the queries once every group succeeded,
+         * so that a failure does not leave prefetched results behind
+         */
+        let prefetched = [];
+
+        for hash, group in groups {
+            let connection = connections[hash];
+
+            if count(group) < 2 || !method_exists(connection, "queryParallel") {
+                continue;
+            }
+
+            for key, result in connection->{"queryParallel"}(group) {
+                let prefetched[key] = result;
+            }
+        }
+
+        for key, result in prefetched {
+            let query                   = queries[key],
+                query->prefetchedResult = result;
+        }
+
+        let results = [];
+
+        try {
+            for key, query in queries {
+                let results[key] = query->execute();
+            }
+        } catch \Throwable, e {
+            for key, result in prefetched {
+                let query                   = queries[key],
+                    query->prefetchedResult = null;
+            }
+
+            throw e;
+        }
+
+        return results;
+    }
+
     /**
      * Executes the query returning the first result
      */
@@ -3974,6 +4115,147 @@ class Query implements QueryInterface, InjectionAwareInterface
         let self::_irPhqlCache = [];
     }
 
+    /**
+     * Returns a cache key derived from the intermediate representation of
+     * the statement and its bind parameters. When the models manager uses
+     * cache tags, the versions of the tables of the statement are part of
+     * the key, so that writes to those tables invalidate the cached result.
+     */
+    protected function getCacheKey(array intermediate, array bindParams, array bindTypes) -> string
+    {
+        var manager;
+        array data;
+
+        let manager = this->manager,
+            data    = [
+                intermediate,
+                bindParams,
+                bindTypes,
+                this->uniqueRow,
+                this->sharedLock
+            ];
+
+        if manager instanceof Manager && manager->isUsingCacheTags() {
+            let data[] = manager->getCacheTagVersions(
+                this->getCacheTags(intermediate)
+            );
+        }
+
+        return "phql-" . md5(serialize(data));
+    }
+
+    /**
+     * Returns the cache tags (tables, with their schema) of a statement
+     */
+    protected function getCacheTags(array intermediate) -> array
+    {
+        var tables, table, joins, join, schema, tag;
+        array sources, tags;
+
+        let sources = [];
+
+        if fetch tables, intermediate["tables"] {
+            if typeof tables != "array" {
+                let tables = [tables];
+            }
+
+            for table in tables {
+                let sources[] = table;
+            }
+        }
+
+        if fetch joins, intermediate["joins"] {
+            for join in joins {
+                let sources[] = join["source"];
+            }
+        }
+
+        let tags = [];
+
+        for table in sources {
+            let tag = table;
+
+            if typeof table == "array" {
+                let tag = table[0];
+
+                if fetch schema, table[1] {
+                    if !empty schema {
+                        let tag = schema . "." . table[0];
+                    }
+                }
+            }
+
+            let tags[tag] = tag;
+        }
+
+        return array_values(tags);
+    }
+
+    /**
+     * Returns the connection, SQL and binds of a SELECT statement for
+     * executeParallel(), or null if the query must run on its own
+     */
+    protected function prepareParallel() -> array | null
+    {
+        var intermediate, bindParams, bindTypes, modelName, model, connection,
+            statement;
+
+        if this->cacheOptions !== null {
+            return null;
+        }
+
+        let intermediate = this->parse();
+
+        if this->type != PHQL_T_SELECT {
+            return null;
+        }
+
+        let bindParams = this->bindParams,
+            bindTypes  = this->bindTypes;
+
+        if typeof bindParams != "array" {
+            let bindParams = [];
+        }
+
+        if typeof bindTypes != "array" {
+            let bindTypes = [];
+        }
+
+        let connection = null;
+
+        for modelName in intermediate["models"] {
+            if !fetch model, this->modelsInstances[modelName] {
+                let model = this->manager->load(modelName),
+                    this->modelsInstances[modelName] = model;
+            }
+
+            let connection = this->getReadConnection(
+                model,
+                intermediate,
+                bindParams,
+                bindTypes
+            );
+        }
+
+        if typeof connection != "object" {
+            return null;
+        }
+
+        let statement = this->_executeSelect(
+            intermediate,
+            bindParams,
+            bindTypes,
+            true
+        );
+
+        return [
+            connection,
+            statement["sql"],
+            statement["bind"],
+            statement["bindTypes"]
+        ];
+    }
+
     /**
      * Gets the read connection from the model if there is no transaction set
      * inside the query object
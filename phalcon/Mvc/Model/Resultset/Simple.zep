@@ -28,6 +28,14 @@ use Phalcon\Storage\Serializer\SerializerInterface;
 class Simple extends Resultset
 {
     protected columnMap;
+
+    /**
+     * Hydrator compiled from the column map and the columns of the first row
+     *
+     * @var array|null
+     */
+    protected hydrator = null;
+
     protected model;
     /**
      * @var bool
@@ -119,9 +127,21 @@ class Simple extends Resultset
                         this->keepSnapshots
                     );
                 } else {
-                    let activeRow = Model::cloneResultMap(
+                    /**
+                     * Every row has the same columns, so the column map is
+                     * resolved once for the whole resultset
+                     */
+                    if this->hydrator === null {
+                        let this->hydrator = Model::compileHydrator(
+                            columnMap,
+                            row
+                        );
+                    }
+
+                    let activeRow = Model::cloneResultHydrator(
                         this->model,
                         row,
+                        this->hydrator,
                         columnMap,
                         Model::DIRTY_STATE_PERSISTENT,
                         this->keepSnapshots
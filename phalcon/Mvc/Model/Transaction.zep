@@ -72,6 +72,13 @@ class Transaction implements TransactionInterface
 
     protected messages;
 
+    /**
+     * Models manager whose cache tags are deferred until the transaction ends
+     *
+     * @var Manager|null
+     */
+    protected modelsManager = null;
+
     protected rollbackRecord;
 
     protected rollbackOnAbort = false;
@@ -83,7 +90,7 @@ class Transaction implements TransactionInterface
      */
     public function __construct(<DiInterface> container, bool autoBegin = false, string service = "db")
     {
-        var connection;
+        var connection, modelsManager;
 
         let this->messages = [];
 
@@ -91,6 +98,14 @@ class Transaction implements TransactionInterface
 
         let this->connection = connection;
 
+        if container->has("modelsManager") {
+            let modelsManager = container->getShared("modelsManager");
+
+            if modelsManager instanceof Manager {
+                let this->modelsManager = modelsManager;
+            }
+        }
+
         if autoBegin {
             connection->begin();
         }
@@ -109,7 +124,7 @@ class Transaction implements TransactionInterface
      */
     public function commit() -> bool
     {
-        var manager;
+        var manager, success;
 
         let manager = this->manager;
 
@@ -117,7 +132,13 @@ class Transaction implements TransactionInterface
             manager->notifyCommit(this);
         }
 
-        return this->connection->commit();
+        let success = this->connection->commit();
+
+        if success && this->modelsManager !== null {
+            this->modelsManager->commitCacheTags(this->connection);
+        }
+
+        return success;
     }
 
     /**
@@ -163,7 +184,7 @@ class Transaction implements TransactionInterface
      */
     public function rollback(string rollbackMessage = null, <ModelInterface> rollbackRecord = null) -> bool
     {
-        var manager, connection;
+        var manager, connection, success;
 
         let manager = this->manager;
 
@@ -171,9 +192,14 @@ class Transaction implements TransactionInterface
             manager->notifyRollback(this);
         }
 
-        let connection = this->connection;
+        let connection = this->connection,
+            success    = connection->rollback();
+
+        if this->modelsManager !== null {
+            this->modelsManager->rollbackCacheTags(connection);
+        }
 
-        if unlikely connection->rollback() {
+        if unlikely success {
             if !rollbackMessage {
                 let rollbackMessage = "Transaction aborted";
             }
@@ -0,0 +1,427 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Paginator\Adapter;
+
+use Phalcon\Mvc\Model\Query\Builder;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\RepositoryInterface;
+
+/**
+ * Phalcon\Paginator\Adapter\Keyset
+ *
+ * Keyset (seek) pagination using a PHQL query builder as source of data.
+ * Instead of an offset, each page starts right after the key of the last
+ * row of the previous page, so deep pages cost the same as the first one
+ * when the key is indexed. The key is a unique column, or a tuple of columns
+ * that is unique, and the pages are addressed with opaque cursors. Counting
+ * the rows is optional.
+ *
+ * ```php
+ * use Phalcon\Paginator\Adapter\Keyset;
+ *
+ * $builder = $this->modelsManager->createBuilder()
+ *                 ->from(Robots::class)
+ *                 ->where("type = :type:", ["type" => "mechanical"]);
+ *
+ * $paginator = new Keyset(
+ *     [
+ *         "builder" => $builder,
+ *         "limit"   => 20,
+ *         "keys"    => ["year", "id"],
+ *         "cursor"  => $this->request->getQuery("cursor"),
+ *     ]
+ * );
+ *
+ * $page = $paginator->paginate();
+ *
+ * // Link to the next page
+ * echo $page->next_cursor;
+ *```
+ */
+class Keyset extends AbstractAdapter
+{
+    /**
+     * Paginator's data
+     */
+    protected builder;
+
+    /**
+     * Whether and how the rows are counted: false, true or a callable
+     */
+    protected count = false;
+
+    /**
+     * Cursor of the requested page, null for the first page
+     */
+    protected cursor = null;
+
+    /**
+     * Whether the keys are sorted in descending order
+     *
+     * @var bool
+     */
+    protected descending = false;
+
+    /**
+     * Key expressions and the attributes of the rows they are read from
+     *
+     * @var array
+     */
+    protected keys = [];
+
+    /**
+     * Phalcon\Paginator\Adapter\Keyset
+     *
+     * @param array config = [
+     *     'limit' => 10,
+     *     'builder' => null,
+     *     'keys' => ['id'],
+     *     'cursor' => null,
+     *     'order' => 'ASC',
+     *     'count' => false
+     * ]
+     */
+    public function __construct(array config)
+    {
+        var builder, keys, key, attribute, cursor, order, countRows;
+
+        if unlikely !isset config["limit"] {
+            throw new Exception("Parameter 'limit' is required");
+        }
+
+        if unlikely !fetch builder, config["builder"] {
+            throw new Exception("Parameter 'builder' is required");
+        }
+
+        if unlikely !(builder instanceof Builder) {
+            throw new Exception(
+                "Parameter 'builder' must be an instance " .
+                "of Phalcon\\Mvc\\Model\\Query\\Builder"
+            );
+        }
+
+        if unlikely !fetch keys, config["keys"] {
+            throw new Exception("Parameter 'keys' is required");
+        }
+
+        if typeof keys == "string" {
+            let keys = [keys];
+        }
+
+        if unlikely (typeof keys != "array" || empty keys) {
+            throw new Exception("Parameter 'keys' must be a column or an array of columns");
+        }
+
+        /**
+         * ["year", "id"] or ["[Robots].year" : "year", ...]
+         */
+        for key, attribute in keys {
+            if typeof key == "integer" {
+                let key       = attribute,
+                    attribute = this->getAttribute(attribute);
+            }
+
+            let this->keys[key] = attribute;
+        }
+
+        if fetch cursor, config["cursor"] {
+            if !empty cursor {
+                let this->cursor = (string) cursor;
+            }
+        }
+
+        if fetch order, config["order"] {
+            let this->descending = strtoupper(order) === "DESC";
+        }
+
+        if fetch countRows, config["count"] {
+            let this->count = countRows;
+        }
+
+        parent::__construct(config);
+
+        this->setQueryBuilder(builder);
+    }
+
+    /**
+     * Get the cursor of the requested page
+     */
+    public function getCursor() -> string | null
+    {
+        return this->cursor;
+    }
+
+    /**
+     * Get query builder object
+     */
+    public function getQueryBuilder() -> <Builder>
+    {
+        return this->builder;
+    }
+
+    /**
+     * Returns the rows of the requested page, with the cursors of the
+     * previous and next pages
+     */
+    public function paginate() -> <RepositoryInterface>
+    {
+        var builder, cursor, values, keys, key, attribute, resultset, row,
+            items, first, last, nextCursor, previousCursor, rowcount,
+            placeholder, condition;
+        bool backwards, ascending, hasMore;
+        array orderBy, conditions, equals, bindParams;
+        int limit, position;
+
+        let builder   = clone this->builder,
+            limit     = (int) this->limitRows,
+            keys      = this->keys,
+            cursor    = this->cursor,
+            values    = null,
+            backwards = false;
+
+        if cursor !== null {
+            let values    = this->decodeCursor(cursor),
+                backwards = values[0] === "p",
+                values    = values[1];
+        }
+
+        /**
+         * Backward pages are read in the reverse order and reversed again
+         */
+        let ascending = this->descending === backwards;
+
+        let orderBy = [];
+
+        for key, attribute in keys {
+            let orderBy[] = key . (ascending ? " ASC" : " DESC");
+        }
+
+        builder->orderBy(orderBy);
+
+        /**
+         * (k1, k2) > (v1, v2) as k1 >= v1 AND (k1 > v1 OR (k1 = v1 AND k2 > v2)),
+         * which every database system supports and can use an index for
+         */
+        if values !== null {
+            let conditions = [],
+                equals     = [],
+                bindParams = [],
+                position   = 0;
+
+            for key, attribute in keys {
+                let placeholder = ":keyset" . position . ":",
+                    condition   = equals;
+
+                let condition[] = key . (ascending ? " > " : " < ") . placeholder;
+
+                let bindParams["keyset" . position] = values[position],
+                    conditions[] = "(" . implode(" AND ", condition) . ")",
+                    equals[]     = key . " = " . placeholder;
+
+                let position++;
+            }
+
+            let key = array_keys(keys)[0];
+
+            if count(keys) > 1 {
+                builder->andWhere(
+                    key . (ascending ? " >= " : " <= ") . ":keyset0: AND (" . implode(" OR ", conditions) . ")",
+                    bindParams
+                );
+            } else {
+                builder->andWhere(conditions[0], bindParams);
+            }
+        }
+
+        /**
+         * One more row tells if there is another page
+         */
+        builder->limit(limit + 1);
+
+        let resultset = builder->getQuery()->execute(),
+            items     = [],
+            hasMore   = false;
+
+        for row in resultset {
+            if count(items) === limit {
+                let hasMore = true;
+
+                break;
+            }
+
+            let items[] = row;
+        }
+
+        if backwards {
+            let items = array_reverse(items);
+        }
+
+        let nextCursor     = null,
+            previousCursor = null;
+
+        if !empty items {
+            let first = items[0],
+                last  = items[count(items) - 1];
+
+            if backwards {
+                let nextCursor = this->encodeCursor("n", last);
+
+                if hasMore {
+                    let previousCursor = this->encodeCursor("p", first);
+                }
+            } else {
+                if hasMore {
+                    let nextCursor = this->encodeCursor("n", last);
+                }
+
+                if cursor !== null {
+                    let previousCursor = this->encodeCursor("p", first);
+                }
+            }
+        }
+
+        let rowcount = this->countRows();
+
+        return this->getRepository(
+            [
+                RepositoryInterface::PROPERTY_ITEMS           : items,
+                RepositoryInterface::PROPERTY_TOTAL_ITEMS     : rowcount,
+                RepositoryInterface::PROPERTY_LIMIT           : this->limitRows,
+                RepositoryInterface::PROPERTY_NEXT_CURSOR     : nextCursor,
+                RepositoryInterface::PROPERTY_PREVIOUS_CURSOR : previousCursor
+            ]
+        );
+    }
+
+    /**
+     * Set the cursor of the requested page, null for the first page
+     */
+    public function setCursor(string cursor = null) -> <Keyset>
+    {
+        let this->cursor = empty cursor ? null : cursor;
+
+        return this;
+    }
+
+    /**
+     * Set query builder object
+     */
+    public function setQueryBuilder(<Builder> builder) -> <Keyset>
+    {
+        let this->builder = builder;
+
+        return this;
+    }
+
+    /**
+     * Counts the rows: not at all (0), with a COUNT(*) query or with a
+     * callable that receives a copy of the builder, for instance to return
+     * an estimate or a cached count
+     */
+    protected function countRows() -> int
+    {
+        var countRows, totalBuilder, row;
+
+        let countRows = this->count;
+
+        if countRows === false || countRows === null {
+            return 0;
+        }
+
+        let totalBuilder = clone this->builder;
+
+        if is_callable(countRows) {
+            return (int) call_user_func(countRows, totalBuilder);
+        }
+
+        if unlikely (!empty totalBuilder->getGroupBy() || !empty totalBuilder->getHaving()) {
+            throw new Exception(
+                "Grouped queries cannot be counted, use a callable for the 'count' option"
+            );
+        }
+
+        let row = totalBuilder->columns("COUNT(*) [rowcount]")
+            ->orderBy(null)
+            ->getQuery()
+            ->execute()
+            ->getFirst();
+
+        return row ? intval(row->rowcount) : 0;
+    }
+
+    /**
+     * Returns the direction ("n" or "p") and the key values of a cursor
+     */
+    protected function decodeCursor(string cursor) -> array
+    {
+        var decoded;
+
+        let decoded = base64_decode(strtr(cursor, "-_", "+/"), true);
+
+        if decoded !== false {
+            let decoded = json_decode(decoded, true);
+        }
+
+        if unlikely (typeof decoded != "array" || count(decoded) !== 2 || (decoded[0] !== "n" && decoded[0] !== "p") || typeof decoded[1] != "array" || count(decoded[1]) !== count(this->keys)) {
+            throw new Exception("The cursor is not valid");
+        }
+
+        return [decoded[0], array_values(decoded[1])];
+    }
+
+    /**
+     * Returns the cursor of the page before ("p") or after ("n") a row
+     */
+    protected function encodeCursor(string direction, var row) -> string
+    {
+        var attribute;
+        array values;
+
+        let values = [];
+
+        for attribute in this->keys {
+            if typeof row == "array" {
+                let values[] = row[attribute];
+            } else {
+                let values[] = row->{attribute};
+            }
+        }
+
+        return rtrim(
+            strtr(
+                base64_encode(
+                    json_encode([direction, values])
+                ),
+                "+/",
+                "-_"
+            ),
+            "="
+        );
+    }
+
+    /**
+     * Returns the attribute of the rows a key expression is read from:
+     * "[Robots].id" is read from "id"
+     */
+    private function getAttribute(string key) -> string
+    {
+        var position;
+
+        let key      = str_replace(["[", "]"], "", key),
+            position = strrpos(key, ".");
+
+        if position === false {
+            return key;
+        }
+
+        return substr(key, position + 1);
+    }
+}
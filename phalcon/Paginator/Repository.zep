@@ -103,6 +103,14 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_LIMIT, 0);
     }
 
+    /**
+     * Gets the cursor of the next page (keyset pagination)
+     */
+    public function getNextCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_NEXT_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
@@ -119,6 +127,14 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_PREVIOUS_PAGE, 0);
     }
 
+    /**
+     * Gets the cursor of the previous page (keyset pagination)
+     */
+    public function getPreviousCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_PREVIOUS_CURSOR, null);
+    }
+
     /**
      * {@inheritdoc}
      */
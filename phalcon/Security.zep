@@ -67,11 +67,25 @@ class Security extends AbstractInjectionAware
      */
     protected requestToken;
 
+    /**
+     * Name of the form field/header carrying stateless CSRF tokens
+     *
+     * @var string
+     */
+    protected statelessTokenKey = "csrf_token";
+
     /**
      * @var string|null
      */
     protected token;
 
+    /**
+     * Validity of stateless CSRF tokens, in seconds
+     *
+     * @var int
+     */
+    protected tokenLifetime = 7200;
+
     /**
      * @var string|null
      */
@@ -82,6 +96,13 @@ class Security extends AbstractInjectionAware
      */
     protected tokenKeySessionId = "$PHALCON/CSRF/KEY$";
 
+    /**
+     * Server secret used to sign stateless CSRF tokens
+     *
+     * @var string|null
+     */
+    protected tokenSecret = null;
+
     /**
      * @var string
      */
@@ -112,6 +133,52 @@ class Security extends AbstractInjectionAware
             this->localSession = session;
     }
 
+    /**
+     * Benchmarks this host and returns the highest bcrypt work factor for
+     * which hashing a password takes no longer than the target latency (in
+     * milliseconds). The result should be cached (it takes at least as long
+     * as a few logins) and passed to `setWorkFactor()`.
+     *
+     *```php
+     * $workFactor = $security->calibrateWorkFactor(50);
+     *
+     * $security->setWorkFactor($workFactor);
+     *```
+     */
+    public function calibrateWorkFactor(float targetMs = 50, int maxWorkFactor = 16) -> int
+    {
+        int workFactor = 4;
+        var elapsed, start;
+
+        if maxWorkFactor > 31 {
+            let maxWorkFactor = 31;
+        }
+
+        while workFactor < maxWorkFactor {
+            let start = microtime(true);
+
+            this->hash("calibration", workFactor + 1);
+
+            let elapsed = (microtime(true) - start) * 1000;
+
+            if elapsed > targetMs {
+                break;
+            }
+
+            let workFactor++;
+
+            /**
+             * Every step doubles the cost - stop before trying a factor that
+             * is bound to exceed the target
+             */
+            if elapsed * 2 > targetMs {
+                break;
+            }
+        }
+
+        return workFactor;
+    }
+
     /**
      * Checks a plain text password and its hash version to check if the
      * password matches
@@ -142,6 +209,37 @@ class Security extends AbstractInjectionAware
         return 0 === sum;
     }
 
+    /**
+     * Checks a password against its hash and, when it matches but the hash
+     * was created with an outdated algorithm or work factor, rehashes the
+     * password with the current settings and passes the new hash to the
+     * callback so that it can be stored. Work factor upgrades are then rolled
+     * out on login, without a bulk migration.
+     *
+     *```php
+     * $valid = $security->checkHashAndRehash(
+     *     $password,
+     *     $user->password,
+     *     function (string $newHash) use ($user) {
+     *         $user->password = $newHash;
+     *         $user->save();
+     *     }
+     * );
+     *```
+     */
+    public function checkHashAndRehash(string password, string passwordHash, callable update, int maxPassLength = 0) -> bool
+    {
+        if !this->checkHash(password, passwordHash, maxPassLength) {
+            return false;
+        }
+
+        if this->needsRehash(passwordHash) {
+            call_user_func(update, this->hash(password));
+        }
+
+        return true;
+    }
+
     /**
      * Check if the CSRF token sent in the request is the same that the current
      * in session
@@ -197,6 +295,52 @@ class Security extends AbstractInjectionAware
         return equals;
     }
 
+    /**
+     * Checks a stateless CSRF token created by `getStatelessToken()`. The
+     * signature, the session it is bound to and its age are verified without
+     * any session I/O. When no value is passed, it is read from the POST
+     * field or the `X-CSRF-Token` header named after the stateless token key.
+     */
+    public function checkStatelessToken(var tokenValue = null, var binding = null) -> bool
+    {
+        var parts, request, timestamp;
+        int age;
+
+        if !tokenValue {
+            let request = this->getLocalRequest();
+
+            if likely request {
+                let tokenValue = request->getPost(this->statelessTokenKey, "string");
+
+                if !tokenValue {
+                    let tokenValue = request->getHeader("X-CSRF-Token");
+                }
+            }
+        }
+
+        if typeof tokenValue !== "string" || !tokenValue {
+            return false;
+        }
+
+        let parts = explode(".", tokenValue);
+
+        if count(parts) !== 3 || !ctype_digit(parts[0]) {
+            return false;
+        }
+
+        let timestamp = parts[0],
+            age       = time() - (int) timestamp;
+
+        if age < 0 || age > this->tokenLifetime {
+            return false;
+        }
+
+        return hash_equals(
+            this->signStatelessToken(timestamp, parts[1], binding),
+            parts[2]
+        );
+    }
+
     /**
      * Computes a HMAC
      */
@@ -292,6 +436,38 @@ class Security extends AbstractInjectionAware
         return null;
     }
 
+    /**
+     * Generates a CSRF token that does not need to be stored in the session.
+     * The token carries its creation time and a random nonce and is signed
+     * (HMAC-SHA256) with the token secret and the session id, so rendering a
+     * form does not write to the session and checking it does not read it.
+     *
+     *```php
+     * $security->setTokenSecret($config->path("app.csrfSecret"));
+     *
+     * echo '<input type="hidden" name="' .
+     *     $security->getStatelessTokenKey() . '" value="' .
+     *     $security->getStatelessToken() . '">';
+     *```
+     */
+    public function getStatelessToken(var binding = null) -> string
+    {
+        var nonce, timestamp;
+
+        let timestamp = (string) time(),
+            nonce     = this->random->base64Safe(this->numberBytes);
+
+        return timestamp . "." . nonce . "." . this->signStatelessToken(timestamp, nonce, binding);
+    }
+
+    /**
+     * Returns the name of the form field carrying stateless CSRF tokens
+     */
+    public function getStatelessTokenKey() -> string
+    {
+        return this->statelessTokenKey;
+    }
+
     /**
      * Generate a >22-length pseudo random string to be used as salt for
      * passwords
@@ -504,6 +680,50 @@ class Security extends AbstractInjectionAware
         return starts_with(passwordHash, "$2a$");
     }
 
+    /**
+     * Checks whether a hash has been created with a different algorithm or
+     * work factor than the ones currently configured
+     */
+    public function needsRehash(string passwordHash, int workFactor = 0) -> bool
+    {
+        int hash;
+
+        if !workFactor {
+            let workFactor = (int) this->workFactor;
+        }
+
+        let hash = (int) this->defaultHash;
+
+        switch hash {
+
+            case self::CRYPT_STD_DES:
+                return strlen(passwordHash) !== 13 || starts_with(passwordHash, "_") || starts_with(passwordHash, "$");
+
+            case self::CRYPT_EXT_DES:
+                return !starts_with(passwordHash, "_");
+
+            case self::CRYPT_MD5:
+                return !starts_with(passwordHash, "$1$");
+
+            case self::CRYPT_SHA256:
+                return !starts_with(passwordHash, "$5$");
+
+            case self::CRYPT_SHA512:
+                return !starts_with(passwordHash, "$6$");
+        }
+
+        if workFactor < 4 {
+            let workFactor = 4;
+        } elseif workFactor > 31 {
+            let workFactor = 31;
+        }
+
+        return !starts_with(
+            passwordHash,
+            "$2" . this->getBlowfishVariant(hash) . "$" . sprintf("%02s", workFactor) . "$"
+        );
+    }
+
     /**
       * Sets the default hash
       */
@@ -525,6 +745,36 @@ class Security extends AbstractInjectionAware
         return this;
     }
 
+    /**
+     * Sets the name of the form field carrying stateless CSRF tokens
+     */
+    public function setStatelessTokenKey(string! tokenKey) -> <Security>
+    {
+        let this->statelessTokenKey = tokenKey;
+
+        return this;
+    }
+
+    /**
+     * Sets the validity of stateless CSRF tokens, in seconds
+     */
+    public function setTokenLifetime(int! lifetime) -> <Security>
+    {
+        let this->tokenLifetime = lifetime;
+
+        return this;
+    }
+
+    /**
+     * Sets the server secret used to sign stateless CSRF tokens
+     */
+    public function setTokenSecret(string! secret) -> <Security>
+    {
+        let this->tokenSecret = secret;
+
+        return this;
+    }
+
     /**
      * Sets the work factor
      */
@@ -535,6 +785,23 @@ class Security extends AbstractInjectionAware
         return this;
     }
 
+    /**
+     * Returns the identifier of the bcrypt variant used for a hash type
+     */
+    private function getBlowfishVariant(int hash) -> string
+    {
+        switch hash {
+
+            case self::CRYPT_BLOWFISH_A:
+                return "a";
+
+            case self::CRYPT_BLOWFISH_X:
+                return "x";
+        }
+
+        return "y";
+    }
+
     private function getLocalRequest() -> <RequestInterface> | null
     {
         var container;
@@ -557,6 +824,45 @@ class Security extends AbstractInjectionAware
         return null;
     }
 
+    /**
+     * Signs the parts of a stateless CSRF token. Tokens are bound to the
+     * session id, read from the session or, when the session has not been
+     * started, from the session cookie.
+     */
+    private function signStatelessToken(string timestamp, string nonce, var binding = null) -> string
+    {
+        var name, session;
+
+        if unlikely empty this->tokenSecret {
+            throw new Exception(
+                "A secret is required to use stateless CSRF tokens"
+            );
+        }
+
+        if null === binding {
+            let binding = "",
+                session = this->getLocalSession();
+
+            if likely session {
+                let binding = session->getId();
+            }
+
+            if !binding {
+                let name = session_name();
+
+                if !fetch binding, _COOKIE[name] {
+                    let binding = "";
+                }
+            }
+        }
+
+        return hash_hmac(
+            "sha256",
+            timestamp . "|" . nonce . "|" . binding,
+            this->tokenSecret
+        );
+    }
+
     private function getLocalSession() -> <SessionInterface> | null
     {
         var container;
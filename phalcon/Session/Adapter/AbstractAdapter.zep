@@ -12,14 +12,30 @@ namespace Phalcon\Session\Adapter;
 
 use Phalcon\Storage\Adapter\AdapterInterface;
 use SessionHandlerInterface;
+use SessionUpdateTimestampHandlerInterface;
 
-abstract class AbstractAdapter implements SessionHandlerInterface
+abstract class AbstractAdapter implements SessionHandlerInterface, SessionUpdateTimestampHandlerInterface
 {
     /**
      * @var AdapterInterface
      */
     protected adapter;
 
+    /**
+     * Checksums of the payloads read, per session id. Used to skip writing
+     * sessions that have not changed.
+     *
+     * @var array
+     */
+    protected checksums = [];
+
+    /**
+     * Time To Live
+     *
+     * @var int
+     */
+    protected lifetime = 3600;
+
     /**
      * Close
      */
@@ -54,9 +70,13 @@ abstract class AbstractAdapter implements SessionHandlerInterface
     public function read(var id) -> string
     {
         var data;
-        let data = this->adapter->get(id);
 
-        return null === data ? "" : data;
+        let data = this->adapter->get(id),
+            data = null === data ? "" : data;
+
+        let this->checksums[id] = md5(data);
+
+        return data;
     }
 
     /**
@@ -68,10 +88,53 @@ abstract class AbstractAdapter implements SessionHandlerInterface
     }
 
     /**
-     * Write
+     * Refreshes the lifetime of a session that has not changed. Adapters
+     * that can extend the expiry without resending the payload override this.
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        return this->adapter->set(id, data);
+    }
+
+    /**
+     * Checks whether a session id exists (used with `session.use_strict_mode`)
+     */
+    public function validateId(var id) -> bool
+    {
+        return this->adapter->has(id);
+    }
+
+    /**
+     * Write. Sessions that have not changed since they were read only get
+     * their lifetime refreshed.
      */
     public function write(var id, var data) -> bool
     {
+        if !this->isDirty(id, data) {
+            return this->updateTimestamp(id, data);
+        }
+
         return this->adapter->set(id, data);
     }
+
+    /**
+     * Checks whether the payload differs from the one that was read for
+     * this session id and keeps its checksum for the next comparison
+     */
+    protected function isDirty(var id, var data) -> bool
+    {
+        var checksum, previous;
+
+        let checksum = md5(data);
+
+        if fetch previous, this->checksums[id] {
+            if previous === checksum {
+                return false;
+            }
+        }
+
+        let this->checksums[id] = checksum;
+
+        return true;
+    }
 }
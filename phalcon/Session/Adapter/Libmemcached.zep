@@ -10,6 +10,7 @@
 
 namespace Phalcon\Session\Adapter;
 
+use Phalcon\Helper\Arr;
 use Phalcon\Storage\AdapterFactory;
 
 /**
@@ -38,6 +39,21 @@ class Libmemcached extends AbstractAdapter
     public function __construct(<AdapterFactory> factory, array! options = [])
     {
         let options["prefix"] = "sess-memc-",
-            this->adapter     = factory->newInstance("libmemcached", options);
+            this->adapter     = factory->newInstance("libmemcached", options),
+            this->lifetime    = (int) Arr::get(options, "lifetime", 3600);
+    }
+
+    /**
+     * Extends the lifetime of an unchanged session without resending it. A
+     * new (empty) session, or one that expired during the request, has no
+     * key to extend and is written instead.
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        if this->adapter->getAdapter()->touch(id, this->lifetime) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
     }
 }
@@ -35,6 +35,14 @@ use Phalcon\Session\Exception;
  */
 class Stream extends Noop
 {
+    /**
+     * Checksums of the payloads read, per session id. Used to skip writing
+     * sessions that have not changed.
+     *
+     * @var array
+     */
+    protected checksums = [];
+
     /**
      * @var string
      */
@@ -127,15 +135,68 @@ class Stream extends Noop
             }
         }
 
+        let this->checksums[id] = md5(data);
+
         return data;
     }
 
+    /**
+     * Refreshes the modification time of an unchanged session so that the
+     * garbage collector keeps it
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        var name;
+
+        let name = this->path . this->getPrefixedName(id);
+
+        if file_exists(name) {
+            return touch(name);
+        }
+
+        return this->write(id, data);
+    }
+
+    public function validateId(var id) -> bool
+    {
+        return file_exists(this->path . this->getPrefixedName(id));
+    }
+
+    /**
+     * Writes the session file. Sessions that have not changed since they were
+     * read are only touched.
+     */
     public function write(var id, var data) -> bool
     {
         var name;
 
         let name = this->path . this->getPrefixedName(id);
 
+        if !this->isDirty(id, data) && file_exists(name) {
+            return touch(name);
+        }
+
         return false !== file_put_contents(name, data);
     }
+
+    /**
+     * Checks whether the payload differs from the one that was read for
+     * this session id and keeps its checksum for the next comparison
+     */
+    protected function isDirty(var id, var data) -> bool
+    {
+        var checksum, previous;
+
+        let checksum = md5(data);
+
+        if fetch previous, this->checksums[id] {
+            if previous === checksum {
+                return false;
+            }
+        }
+
+        let this->checksums[id] = checksum;
+
+        return true;
+    }
 }
@@ -21,6 +21,25 @@ use Phalcon\Helper\Arr;
  * Phalcon\Session\Manager
  *
  * Session manager class
+ *
+ * With the `lazy` option, `start()` only registers the intent to use the
+ * session; the actual `session_start()` happens on the first `get()`, `has()`,
+ * `set()` or `remove()`. Reads do not start a session for clients that do not
+ * have a session cookie yet.
+ *
+ * With the `readOnly` option the session is started with `read_and_close`:
+ * the data is loaded and the lock released straight away, so concurrent
+ * requests of the same user are not serialized. Writing to a read only
+ * session throws an exception.
+ *
+ *```php
+ * $session = new Manager(
+ *     [
+ *         'lazy'     => true,
+ *         'readOnly' => false,
+ *     ]
+ * );
+ *```
  */
 class Manager extends AbstractInjectionAware implements ManagerInterface
 {
@@ -29,6 +48,18 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     private adapter = null;
 
+    /**
+     * @var bool
+     */
+    private lazy = false;
+
+    /**
+     * Whether the data has been loaded in read only mode
+     *
+     * @var bool
+     */
+    private loaded = false;
+
     /**
      * @var string
      */
@@ -39,6 +70,18 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     private options = [];
 
+    /**
+     * Whether start() has been called in lazy mode
+     *
+     * @var bool
+     */
+    private pending = false;
+
+    /**
+     * @var bool
+     */
+    private readOnly = false;
+
     /**
      * @var string
      */
@@ -48,7 +91,9 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      * Manager constructor.
      *
      * @param array options = [
-     *     'uniqueId' => null
+     *     'uniqueId' => null,
+     *     'lazy'     => false,
+     *     'readOnly' => false
      * ]
      */
     public function __construct(array options = [])
@@ -93,11 +138,15 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     public function destroy() -> void
     {
-        if true === this->exists() {
+        this->checkWritable();
+
+        if true === this->load(false) && true === this->exists() {
             session_destroy();
 
             let _SESSION = [];
         }
+
+        let this->pending = false;
     }
 
     /**
@@ -115,7 +164,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey, value = null;
 
-        if false === this->exists() {
+        if false === this->load(false) {
             // To use $_SESSION variable we need to start session first
             return value;
         }
@@ -124,6 +173,8 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
             value     = Arr::get(_SESSION, uniqueKey, defaultValue);
 
         if remove {
+            this->checkWritable();
+
             unset(_SESSION[uniqueKey]);
         }
 
@@ -165,7 +216,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey;
 
-        if false === this->exists() {
+        if false === this->load(false) {
             // To use $_SESSION variable we need to start session first
             return false;
         }
@@ -183,6 +234,14 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         return this->options;
     }
 
+    /**
+     * Whether the session data is loaded in read only mode
+     */
+    public function isReadOnly() -> bool
+    {
+        return this->readOnly;
+    }
+
     /**
      * Regenerates the session id using the adapter.
      */
@@ -204,12 +263,14 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     public function remove(string key) -> void
     {
-        if false === this->exists() {
+        var uniqueKey;
+
+        if false === this->load(true) {
             // To use $_SESSION variable we need to start session first
             return;
         }
 
-        var uniqueKey;
+        this->checkWritable();
 
         let uniqueKey = this->getUniqueKey(key);
 
@@ -223,12 +284,14 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey;
 
-        if false === this->exists() {
+        if false === this->load(true) {
             // To use $_SESSION variable we need to start session first
             return;
         }
 
-         let uniqueKey          = this->getUniqueKey(key),
+        this->checkWritable();
+
+        let uniqueKey           = this->getUniqueKey(key),
             _SESSION[uniqueKey] = value;
     }
 
@@ -296,22 +359,75 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     public function setOptions(array options) -> void
     {
         let this->uniqueId = Arr::get(options, "uniqueId", ""),
+            this->lazy     = (bool) Arr::get(options, "lazy", false),
+            this->readOnly = (bool) Arr::get(options, "readOnly", false),
             this->options  = options;
     }
 
     /**
      * Starts the session (if headers are already sent the session will not be
-     * started)
+     * started). In lazy mode the session is only started when it is first
+     * accessed.
      */
     public function start() -> bool
     {
         /**
          * Check if the session exists
          */
-        if true === this->exists() {
+        if true === this->exists() || true === this->loaded {
+            return true;
+        }
+
+        if unlikely !(this->adapter instanceof SessionHandlerInterface) {
+            throw new Exception("The session adapter is not valid");
+        }
+
+        if true === this->lazy {
+            let this->pending = true;
+
             return true;
         }
 
+        return this->doStart();
+    }
+
+    /**
+     * Returns the status of the current session.
+     */
+    public function status() -> int
+    {
+        var status;
+
+        let status = session_status();
+
+        switch status {
+            case PHP_SESSION_DISABLED:
+                return self::SESSION_DISABLED;
+
+            case PHP_SESSION_ACTIVE:
+                return self::SESSION_ACTIVE;
+        }
+
+        return self::SESSION_NONE;
+    }
+
+    /**
+     * Throws an exception if the session has been opened read only
+     */
+    private function checkWritable() -> void
+    {
+        if unlikely true === this->loaded {
+            throw new Exception(
+                "The session has been opened in read only mode"
+            );
+        }
+    }
+
+    /**
+     * Registers the adapter and starts the session
+     */
+    private function doStart() -> bool
+    {
         /**
          * Cannot start this - headers already sent
          */
@@ -319,15 +435,26 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
             return false;
         }
 
-        if unlikely !(this->adapter instanceof SessionHandlerInterface) {
-            throw new Exception("The session adapter is not valid");
-        }
-
         /**
          * Register the adapter
          */
         session_set_save_handler(this->adapter);
 
+        let this->pending = false;
+
+        /**
+         * Load the data and release the lock straight away
+         */
+        if true === this->readOnly {
+            let this->loaded = session_start(
+                [
+                    "read_and_close" : true
+                ]
+            );
+
+            return this->loaded;
+        }
+
         /**
          * Start the session
          */
@@ -335,23 +462,31 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     }
 
     /**
-     * Returns the status of the current session.
+     * Makes sure the session data is available, starting a pending lazy
+     * session if needed. Reads do not start a session for clients that do
+     * not have one yet.
      */
-    public function status() -> int
+    private function load(bool create) -> bool
     {
-        var status;
+        var name;
 
-        let status = session_status();
+        if true === this->exists() || true === this->loaded {
+            return true;
+        }
 
-        switch status {
-            case PHP_SESSION_DISABLED:
-                return self::SESSION_DISABLED;
+        if false === this->pending {
+            return false;
+        }
 
-            case PHP_SESSION_ACTIVE:
-                return self::SESSION_ACTIVE;
+        if false === create && "" === session_id() {
+            let name = session_name();
+
+            if !isset _COOKIE[name] {
+                return false;
+            }
         }
 
-        return self::SESSION_NONE;
+        return this->doStart();
     }
 
     /**
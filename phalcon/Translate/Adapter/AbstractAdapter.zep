@@ -26,6 +26,11 @@ abstract class AbstractAdapter implements AdapterInterface
      */
     protected defaultInterpolator = "";
 
+    /**
+     * @var InterpolatorInterface|null
+     */
+    protected interpolator = null;
+
     /**
     * @var InterpolatorFactory
     */
@@ -100,7 +105,15 @@ abstract class AbstractAdapter implements AdapterInterface
     ) -> string {
         var interpolator;
 
-        let interpolator = this->interpolatorFactory->newInstance(this->defaultInterpolator);
+        /**
+         * The interpolators are stateless, one instance is enough
+         */
+        let interpolator = this->interpolator;
+
+        if null === interpolator {
+            let interpolator       = this->interpolatorFactory->newInstance(this->defaultInterpolator),
+                this->interpolator = interpolator;
+        }
 
         return interpolator->replacePlaceholders(
             translation,
@@ -0,0 +1,276 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Translate\Adapter;
+
+use ArrayAccess;
+use Phalcon\Translate\Exception;
+use Phalcon\Translate\InterpolatorFactory;
+
+/**
+ * Phalcon\Translate\Adapter\Catalog
+ *
+ * Reads a translation catalog compiled with `compile()`. The catalog is a
+ * plain PHP array file, which opcache keeps in shared memory, so neither the
+ * CSV file nor the gettext catalog is parsed on each request. Messages with
+ * `%name%` placeholders are also compiled into literal and placeholder
+ * segments, so the `associativeArray` interpolation is a single pass over
+ * the segments instead of a replacement per placeholder.
+ *
+ * ```php
+ * use Phalcon\Translate\Adapter\Catalog;
+ * use Phalcon\Translate\Adapter\Csv;
+ * use Phalcon\Translate\InterpolatorFactory;
+ *
+ * $interpolator = new InterpolatorFactory();
+ *
+ * // deployment
+ * Catalog::compile(
+ *     new Csv(
+ *         $interpolator,
+ *         [
+ *             "content" => "locales/de_DE.csv",
+ *         ]
+ *     ),
+ *     "cache/de_DE.php"
+ * );
+ *
+ * // bootstrap
+ * $translator = new Catalog(
+ *     $interpolator,
+ *     [
+ *         "content" => "cache/de_DE.php",
+ *     ]
+ * );
+ * ```
+ */
+class Catalog extends AbstractAdapter implements ArrayAccess
+{
+    /**
+     * Compiled segments of the messages with placeholders
+     *
+     * @var array
+     */
+    protected templates = [];
+
+    /**
+     * @var array
+     */
+    protected translate = [];
+
+    /**
+     * @var bool
+     */
+    protected triggerError = false;
+
+    /**
+     * Phalcon\Translate\Adapter\Catalog constructor
+     *
+     * @param array options = [
+     *     'content' => '',
+     *     'triggerError' => false
+     * ]
+     */
+    public function __construct(<InterpolatorFactory> interpolator, array! options)
+    {
+        var compiled, content, error;
+
+        parent::__construct(interpolator, options);
+
+        if unlikely !fetch content, options["content"] {
+            throw new Exception("Parameter 'content' is required");
+        }
+
+        if fetch error, options["triggerError"] {
+            let this->triggerError = (bool) error;
+        }
+
+        /**
+         * The file written by compile() or the array it returned
+         */
+        if typeof content === "array" {
+            let compiled = content;
+        } else {
+            let compiled = require content;
+        }
+
+        if unlikely (typeof compiled !== "array" || !isset compiled["messages"] || !isset compiled["templates"]) {
+            throw new Exception("The content is not a compiled translation catalog");
+        }
+
+        let this->translate = compiled["messages"],
+            this->templates = compiled["templates"];
+    }
+
+    /**
+     * Compiles the messages of an adapter (Csv, Gettext, NativeArray) or of
+     * an array and writes them to a PHP file that the adapter can read.
+     * Returns the compiled catalog.
+     *
+     * @param AdapterInterface|array $source
+     */
+    public static function compile(var source, string! filePath) -> array
+    {
+        var compiled, key, message, messages, template;
+        array templates;
+
+        if typeof source === "array" {
+            let messages = source;
+        } elseif typeof source === "object" && method_exists(source, "toArray") {
+            let messages = source->toArray();
+        } else {
+            throw new Exception("Invalid source for the translation catalog");
+        }
+
+        let templates = [];
+
+        for key, message in messages {
+            let template = self::compileTemplate((string) message);
+
+            if null !== template {
+                let templates[key] = template;
+            }
+        }
+
+        let compiled = [
+            "messages"  : messages,
+            "templates" : templates
+        ];
+
+        self::write(compiled, filePath);
+
+        return compiled;
+    }
+
+    /**
+     * Check whether is defined a translation key in the internal array
+     */
+    public function exists(string! index) -> bool
+    {
+        return isset this->translate[index];
+    }
+
+    /**
+     * Returns the translation related to the given key
+     */
+    public function query(string! index, array placeholders = []) -> string
+    {
+        var key, segment, template, translation, value;
+        string result;
+
+        if !fetch translation, this->translate[index] {
+            if unlikely this->triggerError {
+                throw new Exception("Cannot find translation key: " . index);
+            }
+
+            return this->replacePlaceholders(index, placeholders);
+        }
+
+        if empty placeholders {
+            return translation;
+        }
+
+        if this->defaultInterpolator !== "associativeArray" {
+            return this->replacePlaceholders(translation, placeholders);
+        }
+
+        if !fetch template, this->templates[index] {
+            /**
+             * No well formed placeholders; anything else is left to the
+             * interpolator
+             */
+            if false === strpos(translation, "%") {
+                return translation;
+            }
+
+            return this->replacePlaceholders(translation, placeholders);
+        }
+
+        /**
+         * Even segments are literals, odd segments placeholder names
+         */
+        let result = "";
+
+        for key, segment in template {
+            if key % 2 === 0 {
+                let result .= segment;
+            } elseif fetch value, placeholders[segment] {
+                let result .= value;
+            } else {
+                let result .= "%" . segment . "%";
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Returns the messages of the catalog
+     */
+    public function toArray() -> array
+    {
+        return this->translate;
+    }
+
+    /**
+     * Splits a message into literal and placeholder segments. Returns null
+     * for messages without placeholders and for messages with a `%` that is
+     * not part of a placeholder.
+     */
+    private static function compileTemplate(string message) -> array | null
+    {
+        var key, segment, segments;
+
+        if false === strpos(message, "%") {
+            return null;
+        }
+
+        let segments = preg_split(
+            "/%([^%\\s]+)%/",
+            message,
+            -1,
+            PREG_SPLIT_DELIM_CAPTURE
+        );
+
+        if typeof segments !== "array" || count(segments) < 2 {
+            return null;
+        }
+
+        for key, segment in segments {
+            if key % 2 === 0 && false !== strpos(segment, "%") {
+                return null;
+            }
+        }
+
+        return segments;
+    }
+
+    /**
+     * Writes the compiled catalog, through a temporary file so that
+     * concurrent requests never read a partial file
+     */
+    private static function write(array compiled, string filePath) -> void
+    {
+        var temporary;
+
+        let temporary = filePath . "." . uniqid("", true);
+
+        if unlikely false === file_put_contents(
+            temporary,
+            "<?php\n\nreturn " . var_export(compiled, true) . ";\n"
+        ) {
+            throw new Exception(
+                "The translation catalog could not be written to '" . filePath . "'"
+            );
+        }
+
+        rename(temporary, filePath);
+    }
+}
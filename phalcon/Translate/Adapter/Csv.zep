@@ -82,6 +82,14 @@ class Csv extends AbstractAdapter implements ArrayAccess
         return this->replacePlaceholders(translation, placeholders);
     }
 
+    /**
+     * Returns the messages of the translation list
+     */
+    public function toArray() -> array
+    {
+        return this->translate;
+    }
+
     /**
     * Load translates from file
     */
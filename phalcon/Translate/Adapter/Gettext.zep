@@ -54,6 +54,13 @@ class Gettext extends AbstractAdapter implements ArrayAccess
      */
     protected locale { get };
 
+    /**
+     * Locale names passed to setLocale(), in order of preference
+     *
+     * @var array
+     */
+    protected locales = [];
+
     /**
      * Phalcon\Translate\Adapter\Gettext constructor
      *
@@ -209,11 +216,29 @@ class Gettext extends AbstractAdapter implements ArrayAccess
      */
     public function setLocale(int! category, string! locale) -> string | bool
     {
+        var argument, arguments, name;
+
+        let arguments    = func_get_args(),
+            this->locales = [];
+
         let this->locale = call_user_func_array(
             "setlocale",
-            func_get_args()
+            arguments
         );
 
+        /**
+         * setlocale() also accepts arrays of names
+         */
+        for argument in array_slice(arguments, 1) {
+            if typeof argument === "array" {
+                for name in argument {
+                    let this->locales[] = (string) name;
+                }
+            } else {
+                let this->locales[] = (string) argument;
+            }
+        }
+
         let this->category = category;
 
         putenv("LC_ALL=" . this->locale);
@@ -224,6 +249,128 @@ class Gettext extends AbstractAdapter implements ArrayAccess
         return this->locale;
     }
 
+    /**
+     * Returns the singular messages of the default domain, read from its
+     * compiled (.mo) catalog for the current locale. The catalog is looked
+     * up like gettext does: "de_DE.UTF-8" tries "de_DE.UTF-8", "de_DE.utf8",
+     * "de_DE" and then "de". The names passed to setLocale() are tried too,
+     * so a locale that is not installed on the system can still be read.
+     */
+    public function toArray() -> array
+    {
+        var candidate, data, directory, domains, entry, file, format, header,
+            locale, original, path, translation;
+        int count, i;
+        array locales, messages;
+
+        let directory = this->directory;
+
+        if typeof directory === "array" {
+            let domains = directory;
+
+            if unlikely !fetch directory, domains[this->defaultDomain] {
+                throw new Exception(
+                    "There is no directory for the domain '" . this->defaultDomain . "'"
+                );
+            }
+        }
+
+        let locales = this->locales;
+
+        if typeof this->locale === "string" {
+            let locales = array_merge([this->locale], locales);
+        }
+
+        if unlikely empty locales {
+            throw new Exception("The locale has not been set");
+        }
+
+        let directory = rtrim(directory, "\\/") . DIRECTORY_SEPARATOR,
+            file      = null;
+
+        for locale in locales {
+            for candidate in this->getLocaleCandidates(locale) {
+                let path = directory . candidate . DIRECTORY_SEPARATOR
+                    . "LC_MESSAGES" . DIRECTORY_SEPARATOR . this->defaultDomain
+                    . ".mo";
+
+                if is_file(path) {
+                    let file = path;
+
+                    break;
+                }
+            }
+
+            if file !== null {
+                break;
+            }
+        }
+
+        if unlikely file === null {
+            throw new Exception(
+                "There is no translation file for the domain '" . this->defaultDomain
+                . "' and the locale '" . locales[0] . "' in '" . directory . "'"
+            );
+        }
+
+        let data = file_get_contents(file);
+
+        if unlikely (false === data || strlen(data) < 20) {
+            throw new Exception(
+                "Error opening translation file '" . file . "'"
+            );
+        }
+
+        /**
+         * The magic number tells the byte order of the file
+         */
+        let header = unpack("V", substr(data, 0, 4));
+
+        if header[1] == 2500072158 {
+            let format = "V";
+        } else {
+            let header = unpack("N", substr(data, 0, 4));
+
+            if unlikely header[1] != 2500072158 {
+                throw new Exception(
+                    "The file '" . file . "' is not a gettext catalog"
+                );
+            }
+
+            let format = "N";
+        }
+
+        let header = unpack(
+            format . "revision/" . format . "count/" . format . "originals/" . format . "translations",
+            substr(data, 4, 16)
+        );
+
+        let count    = header["count"],
+            messages = [],
+            i        = 0;
+
+        while i < count {
+            let entry    = unpack(format . "length/" . format . "offset", substr(data, header["originals"] + i * 8, 8)),
+                original = (string) substr(data, entry["offset"], entry["length"]);
+
+            let entry       = unpack(format . "length/" . format . "offset", substr(data, header["translations"] + i * 8, 8)),
+                translation = (string) substr(data, entry["offset"], entry["length"]);
+
+            let i++;
+
+            /**
+             * Skip the header entry and the plural forms
+             */
+            if original === "" || false !== strpos(original, chr(0)) {
+                continue;
+            }
+
+            let messages[original] = translation;
+        }
+
+        return messages;
+    }
+
     /**
      * Gets default options
      */
@@ -235,6 +382,64 @@ class Gettext extends AbstractAdapter implements ArrayAccess
         ];
     }
 
+    /**
+     * Returns the names a catalog of a locale can be stored under, from the
+     * most to the least specific, like gettext: the locale, then without its
+     * codeset or with the codeset normalized ("UTF-8" as "utf8"), then
+     * without its territory and finally without its modifier
+     */
+    protected function getLocaleCandidates(string locale) -> array
+    {
+        var codeset, codesets, language, matches, modifier, modifiers,
+            territory, territories;
+        array candidates;
+
+        if !preg_match("/^([^_.@]+)(_[^.@]*)?(\\.[^@]*)?(@.*)?$/", locale, matches) {
+            return [locale];
+        }
+
+        let language    = matches[1],
+            territories = [],
+            codesets    = [],
+            modifiers   = [];
+
+        if fetch modifier, matches[4] {
+            if modifier !== "" {
+                let modifiers[] = modifier;
+            }
+        }
+
+        if fetch codeset, matches[3] {
+            if codeset !== "" {
+                let codesets[] = codeset,
+                    codesets[] = "." . strtolower(preg_replace("/[^a-z0-9]/i", "", codeset));
+            }
+        }
+
+        if fetch territory, matches[2] {
+            if territory !== "" {
+                let territories[] = territory;
+            }
+        }
+
+        let modifiers[]   = "",
+            territories[] = "",
+            codesets[]    = "",
+            candidates    = [];
+
+        for modifier in modifiers {
+            for territory in territories {
+                for codeset in codesets {
+                    let candidates[] = language . territory . codeset . modifier;
+                }
+            }
+        }
+
+        return array_values(
+            array_unique(candidates)
+        );
+    }
+
     /**
      * Validator for constructor
      */
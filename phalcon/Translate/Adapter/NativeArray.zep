@@ -93,4 +93,12 @@ class NativeArray extends AbstractAdapter implements ArrayAccess
 
         return this->replacePlaceholders(translation, placeholders);
     }
+
+    /**
+     * Returns the messages of the translation list
+     */
+    public function toArray() -> array
+    {
+        return this->translate;
+    }
 }
@@ -83,6 +83,7 @@ class TranslateFactory extends AbstractFactory
     protected function getAdapters() -> array
     {
         return [
+            "catalog" : "Phalcon\\Translate\\Adapter\\Catalog",
             "csv"     : "Phalcon\\Translate\\Adapter\\Csv",
             "gettext" : "Phalcon\\Translate\\Adapter\\Gettext",
             "array"   : "Phalcon\\Translate\\Adapter\\NativeArray"
@@ -46,6 +46,14 @@ class Url extends AbstractInjectionAware implements UrlInterface
      */
     protected basePath = null;
 
+    /**
+     * Reverse routes compiled by name: literal segments alternating with
+     * the names of the parameters to insert between them
+     *
+     * @var array
+     */
+    protected compiledRoutes = [];
+
     /**
      * @var RouterInterface | null
      */
@@ -61,6 +69,28 @@ class Url extends AbstractInjectionAware implements UrlInterface
         let this->router = router;
     }
 
+    /**
+     * Compiles the reverse routes of every named route of the router and
+     * returns them. The result can be cached and given to setCompiledRoutes()
+     * on later requests so that get() does not look the routes up.
+     */
+    public function compileRoutes() -> array
+    {
+        var name, route;
+
+        let this->compiledRoutes = [];
+
+        for route in this->getRouter()->getRoutes() {
+            let name = route->getName();
+
+            if typeof name == "string" && name !== "" {
+                let this->compiledRoutes[name] = this->compileRoute(route);
+            }
+        }
+
+        return this->compiledRoutes;
+    }
+
     /**
      * Generates a URL
      *
@@ -101,7 +131,7 @@ class Url extends AbstractInjectionAware implements UrlInterface
     public function get(var uri = null, var args = null, bool local = null, var baseUri = null) -> string
     {
         string strUri;
-        var router, container, routeName, route, queryString;
+        var routeName, route, queryString, segments;
 
         if local == null {
             if typeof uri == "string" && (memstr(uri, "//") || memstr(uri, ":")) {
@@ -126,53 +156,26 @@ class Url extends AbstractInjectionAware implements UrlInterface
                 );
             }
 
-            let router = this->router;
-
             /**
-             * Check if the router has not previously set
+             * Named routes are compiled the first time they are used
              */
-            if unlikely !router {
-                let container = <DiInterface> this->container;
+            if !fetch segments, this->compiledRoutes[routeName] {
+                let route = <RouteInterface> this->getRouter()->getRouteByName(routeName);
 
-                if unlikely typeof container != "object" {
+                if unlikely typeof route != "object" {
                     throw new Exception(
-                        Exception::containerServiceNotFound(
-                            "the 'router' service"
-                        )
+                        "Cannot obtain a route using the name '" . routeName . "'"
                     );
                 }
 
-                if unlikely !container->has("router") {
-                    throw new Exception(
-                        Exception::containerServiceNotFound(
-                            "the 'router' service"
-                        )
-                    );
-                }
-
-                let router       = <RouterInterface> container->getShared("router"),
-                    this->router = router;
+                let segments                        = this->compileRoute(route),
+                    this->compiledRoutes[routeName] = segments;
             }
 
             /**
-             * Every route is uniquely differenced by a name
+             * Replace the parameters in the compiled pattern
              */
-            let route = <RouteInterface> router->getRouteByName(routeName);
-
-            if unlikely typeof route != "object" {
-                throw new Exception(
-                    "Cannot obtain a route using the name '" . routeName . "'"
-                );
-            }
-
-            /**
-             * Replace the patterns by its variables
-             */
-            let uri = phalcon_replace_paths(
-                route->getPattern(),
-                route->getReversedPaths(),
-                uri
-            );
+            let uri = this->replaceSegments(segments, uri);
         }
 
         if local {
@@ -310,6 +313,17 @@ class Url extends AbstractInjectionAware implements UrlInterface
         return this;
     }
 
+    /**
+     * Sets the reverse routes returned by compileRoutes(). Pass an empty
+     * array after changing the routes of the router.
+     */
+    public function setCompiledRoutes(array! compiledRoutes) -> <UrlInterface>
+    {
+        let this->compiledRoutes = compiledRoutes;
+
+        return this;
+    }
+
     /**
      * Sets a prefix for all static URLs generated
      *
@@ -331,4 +345,127 @@ class Url extends AbstractInjectionAware implements UrlInterface
     {
         return this->basePath . path;
     }
+
+    /**
+     * Splits the pattern of a route into literal segments and parameter
+     * names. The pattern goes through phalcon_replace_paths() once, with a
+     * marker in place of each parameter, so the result matches what it
+     * would return for any set of parameters.
+     */
+    private function compileRoute(<RouteInterface> route) -> array
+    {
+        var matches, name, names, pattern, paths, position, replaced, segment,
+            segments, tokens;
+        int index;
+
+        let pattern = route->getPattern(),
+            paths   = route->getReversedPaths(),
+            names   = [];
+
+        for name in paths {
+            if typeof name == "string" && !is_numeric(name) {
+                let names[name] = true;
+            }
+        }
+
+        let matches = [];
+
+        if preg_match_all("#\\{([a-zA-Z][a-zA-Z0-9_-]*)#", pattern, matches) {
+            for name in matches[1] {
+                if !is_numeric(name) {
+                    let names[name] = true;
+                }
+            }
+        }
+
+        let names  = array_keys(names),
+            tokens = [];
+
+        for index, name in names {
+            let tokens[name] = chr(0) . index . chr(0);
+        }
+
+        let replaced = phalcon_replace_paths(pattern, paths, tokens);
+
+        if typeof replaced != "string" {
+            return [""];
+        }
+
+        /**
+         * Literals never contain NUL bytes, so the pieces alternate between
+         * literals and parameter indexes
+         */
+        let segments = [];
+
+        for position, segment in explode(chr(0), replaced) {
+            if position % 2 {
+                let segments[] = names[(int) segment];
+            } else {
+                let segments[] = segment;
+            }
+        }
+
+        return segments;
+    }
+
+    /**
+     * Returns the router, from the container if none has been set
+     */
+    private function getRouter() -> <RouterInterface>
+    {
+        var container, router;
+
+        let router = this->router;
+
+        /**
+         * Check if the router has not previously set
+         */
+        if unlikely !router {
+            let container = <DiInterface> this->container;
+
+            if unlikely typeof container != "object" {
+                throw new Exception(
+                    Exception::containerServiceNotFound(
+                        "the 'router' service"
+                    )
+                );
+            }
+
+            if unlikely !container->has("router") {
+                throw new Exception(
+                    Exception::containerServiceNotFound(
+                        "the 'router' service"
+                    )
+                );
+            }
+
+            let router       = <RouterInterface> container->getShared("router"),
+                this->router = router;
+        }
+
+        return router;
+    }
+
+    /**
+     * Builds a URI from compiled segments in a single pass
+     */
+    private function replaceSegments(array! segments, array! parameters) -> string
+    {
+        var position, segment, value;
+        string result;
+
+        let result = "";
+
+        for position, segment in segments {
+            if position % 2 {
+                if fetch value, parameters[segment] {
+                    let result .= value;
+                }
+            } else {
+                let result .= segment;
+            }
+        }
+
+        return result;
+    }
 }
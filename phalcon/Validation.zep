@@ -29,9 +29,23 @@ class Validation extends Injectable implements ValidationInterface
     protected data { get };
     protected entity;
     protected filters = [];
+
+    /**
+     * @var FilterInterface|null
+     */
+    protected filterService = null;
+
     protected labels = [];
     protected messages;
-    protected validators { set };
+
+    /**
+     * Validation plan (see compile())
+     *
+     * @var array|null
+     */
+    protected plan = null;
+
+    protected validators;
     protected values;
 
     /**
@@ -68,6 +82,8 @@ class Validation extends Injectable implements ValidationInterface
     {
         var singleField;
 
+        let this->plan = null;
+
         if typeof field == "array" {
             // Uniqueness validator for combination of fields is handled differently
             if validator instanceof AbstractCombinedFieldsValidator {
@@ -128,6 +144,117 @@ class Validation extends Injectable implements ValidationInterface
         return this;
     }
 
+    /**
+     * Builds a plan from the validators: a flat list of rules in which the
+     * allowEmpty and cancelOnFail options of each validator are read once
+     * instead of on every validation, along with the filters and labels.
+     * The validators themselves run as usual. Validations with a plan (from
+     * compile() or setPlan()) run its rules; adding validators, filters or
+     * labels afterwards discards the plan.
+     *
+     * The plan is a plain array and can be stored (for instance in APCu)
+     * and shared between requests, as long as the validators can be
+     * serialized.
+     *
+     *```php
+     * $plan = apcu_fetch("validation.user");
+     *
+     * if (false === $plan) {
+     *     $plan = (new UserValidation())->compile();
+     *
+     *     apcu_store("validation.user", $plan);
+     * }
+     *
+     * $validation = new \Phalcon\Validation();
+     *
+     * $validation->setPlan($plan);
+     *
+     * foreach ($items as $item) {
+     *     $messages = $validation->validate($item);
+     * }
+     *```
+     */
+    public function compile() -> array
+    {
+        var field, next, rule, scope, validator, validators;
+        array rules;
+        int first, i;
+
+        let rules = [];
+
+        if typeof this->validators == "array" {
+            for field, validators in this->validators {
+                let first = count(rules);
+
+                for validator in validators {
+                    if unlikely typeof validator != "object" {
+                        throw new Exception("One of the validators is not valid");
+                    }
+
+                    let rules[] = this->compileRule(field, validator, false);
+                }
+
+                /**
+                 * A failing validator with "cancelOnFail" skips the remaining
+                 * validators of the field
+                 */
+                let next = count(rules),
+                    i    = first;
+
+                while i < next {
+                    let rule = rules[i];
+
+                    if rule["next"] !== null {
+                        let rule["next"] = next,
+                            rules[i]     = rule;
+                    }
+
+                    let i++;
+                }
+            }
+        }
+
+        if typeof this->combinedFieldsValidators == "array" {
+            for scope in this->combinedFieldsValidators {
+                if unlikely typeof scope != "array" {
+                    throw new Exception("The validator scope is not valid");
+                }
+
+                if unlikely typeof scope[1] != "object" {
+                    throw new Exception("One of the validators is not valid");
+                }
+
+                let rules[] = this->compileRule(scope[0], scope[1], true);
+            }
+
+            /**
+             * A failing combined validator with "cancelOnFail" stops the
+             * validation
+             */
+            let next = count(rules),
+                i    = 0;
+
+            while i < next {
+                let rule = rules[i];
+
+                if rule["combined"] && rule["next"] !== null {
+                    let rule["next"] = next,
+                        rules[i]     = rule;
+                }
+
+                let i++;
+            }
+        }
+
+        let this->plan = [
+            "rules"   : rules,
+            "filters" : this->filters,
+            "labels"  : this->labels
+        ];
+
+        return this->plan;
+    }
+
     /**
      * Returns the bound entity
      */
@@ -186,6 +313,14 @@ class Validation extends Injectable implements ValidationInterface
         return this->messages;
     }
 
+    /**
+     * Returns the compiled plan, if any
+     */
+    public function getPlan() -> array | null
+    {
+        return this->plan;
+    }
+
     /**
      * Returns the validators added to the validation
      */
@@ -253,24 +388,33 @@ class Validation extends Injectable implements ValidationInterface
 
         if fetch fieldFilters, filters[field] {
             if fieldFilters {
-                let container = this->getDI();
+                /**
+                 * The filter service is resolved once per validation
+                 */
+                let filterService = this->filterService;
 
-                if typeof container != "object" {
-                    let container = Di::getDefault();
+                if typeof filterService != "object" {
+                    let container = this->getDI();
 
-                    if unlikely typeof container != "object" {
-                        throw new Exception(
-                            Exception::containerServiceNotFound(
-                                "the 'filter' service"
-                            )
-                        );
+                    if typeof container != "object" {
+                        let container = Di::getDefault();
+
+                        if unlikely typeof container != "object" {
+                            throw new Exception(
+                                Exception::containerServiceNotFound(
+                                    "the 'filter' service"
+                                )
+                            );
+                        }
                     }
-                }
 
-                let filterService = <FilterInterface> container->getShared("filter");
+                    let filterService = <FilterInterface> container->getShared("filter");
 
-                if unlikely typeof filterService != "object" {
-                    throw new Exception("Returned 'filter' service is invalid");
+                    if unlikely typeof filterService != "object" {
+                        throw new Exception("Returned 'filter' service is invalid");
+                    }
+
+                    let this->filterService = filterService;
                 }
 
                 let value = filterService->sanitize(value, fieldFilters);
@@ -362,6 +506,8 @@ class Validation extends Injectable implements ValidationInterface
             );
         }
 
+        let this->plan = null;
+
         return this;
     }
 
@@ -370,7 +516,62 @@ class Validation extends Injectable implements ValidationInterface
      */
     public function setLabels(array! labels) -> void
     {
-        let this->labels = labels;
+        let this->labels = labels,
+            this->plan   = null;
+    }
+
+    /**
+     * Uses a plan returned by compile(), replacing the validators, filters
+     * and labels of the validation
+     */
+    public function setPlan(array! plan) -> <ValidationInterface>
+    {
+        var rule, rules;
+
+        if unlikely !fetch rules, plan["rules"] {
+            throw new Exception("The validation plan is not valid");
+        }
+
+        if unlikely typeof rules != "array" {
+            throw new Exception("The validation plan is not valid");
+        }
+
+        let this->validators               = [],
+            this->combinedFieldsValidators = [];
+
+        for rule in rules {
+            if rule["combined"] {
+                let this->combinedFieldsValidators[] = [
+                    rule["field"],
+                    rule["validator"]
+                ];
+            } else {
+                let this->validators[rule["field"]][] = rule["validator"];
+            }
+        }
+
+        if isset plan["filters"] {
+            let this->filters = plan["filters"];
+        }
+
+        if isset plan["labels"] {
+            let this->labels = plan["labels"];
+        }
+
+        let this->plan = plan;
+
+        return this;
+    }
+
+    /**
+     * Replaces the validators of the validation
+     */
+    public function setValidators(array validators) -> <ValidationInterface>
+    {
+        let this->validators = validators,
+            this->plan       = null;
+
+        return this;
     }
 
     /**
@@ -394,7 +595,8 @@ class Validation extends Injectable implements ValidationInterface
         /**
          * Clear pre-calculated values
          */
-        let this->values = null;
+        let this->values        = null,
+            this->filterService = null;
 
         /**
          * Implicitly creates a Phalcon\Messages\Messages object
@@ -426,8 +628,42 @@ class Validation extends Injectable implements ValidationInterface
             let this->data = data;
         }
 
-        for field, validators in validatorData {
-            for validator in validators {
+        if this->plan !== null {
+            this->validatePlan(this->plan["rules"]);
+        } else {
+            for field, validators in validatorData {
+                for validator in validators {
+                    if unlikely typeof validator != "object" {
+                        throw new Exception("One of the validators is not valid");
+                    }
+
+                    /**
+                     * Call internal validations, if it returns true, then skip the
+                     * current validator
+                     */
+                    if this->preChecking(field, validator) {
+                        continue;
+                    }
+
+                    /**
+                     * Check if the validation must be canceled if this validator fails
+                     */
+                    if validator->validate(this, field) === false {
+                        if validator->getOption("cancelOnFail") {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            for scope in combinedFieldsValidators {
+                if unlikely typeof scope != "array" {
+                    throw new Exception("The validator scope is not valid");
+                }
+
+                let field     = scope[0],
+                    validator = scope[1];
+
                 if unlikely typeof validator != "object" {
                     throw new Exception("One of the validators is not valid");
                 }
@@ -451,36 +687,6 @@ class Validation extends Injectable implements ValidationInterface
             }
         }
 
-        for scope in combinedFieldsValidators {
-            if unlikely typeof scope != "array" {
-                throw new Exception("The validator scope is not valid");
-            }
-
-            let field     = scope[0],
-                validator = scope[1];
-
-            if unlikely typeof validator != "object" {
-                throw new Exception("One of the validators is not valid");
-            }
-
-            /**
-             * Call internal validations, if it returns true, then skip the
-             * current validator
-             */
-            if this->preChecking(field, validator) {
-                continue;
-            }
-
-            /**
-             * Check if the validation must be canceled if this validator fails
-             */
-            if validator->validate(this, field) === false {
-                if validator->getOption("cancelOnFail") {
-                    break;
-                }
-            }
-        }
-
         /**
          * Get the messages generated by the validators
          */
@@ -532,4 +738,87 @@ class Validation extends Injectable implements ValidationInterface
 
         return false;
     }
+
+    /**
+     * Builds a rule of the plan
+     */
+    private function compileRule(var field, <ValidatorInterface> validator, bool combined) -> array
+    {
+        return [
+            "field"        : field,
+            "validator"    : validator,
+            "combined"     : combined,
+            "allowEmpty"   : validator->getOption("allowEmpty", false),
+            "isAllowEmpty" : method_exists(validator, "isAllowEmpty"),
+            "next"         : validator->getOption("cancelOnFail") ? -1 : null
+        ];
+    }
+
+    /**
+     * preChecking() using the options resolved in the rule
+     */
+    private function planPreChecking(var field, array! rule) -> bool
+    {
+        var allowEmpty, emptyValue, singleField, value;
+
+        if typeof field == "array" {
+            for singleField in field {
+                if this->planPreChecking(singleField, rule) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        let allowEmpty = rule["allowEmpty"];
+
+        if !allowEmpty {
+            return false;
+        }
+
+        if rule["isAllowEmpty"] {
+            return rule["validator"]->isAllowEmpty(this, field);
+        }
+
+        let value = this->getValue(field);
+
+        if typeof allowEmpty == "array" {
+            for emptyValue in allowEmpty {
+                if emptyValue === value {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        return empty value;
+    }
+
+    /**
+     * Runs the rules of a compiled plan
+     */
+    private function validatePlan(array! rules) -> void
+    {
+        var rule, validator;
+        int count, i;
+
+        let count = count(rules),
+            i     = 0;
+
+        while i < count {
+            let rule      = rules[i],
+                validator = rule["validator"],
+                i++;
+
+            if this->planPreChecking(rule["field"], rule) {
+                continue;
+            }
+
+            if validator->validate(this, rule["field"]) === false && rule["next"] !== null {
+                let i = (int) rule["next"];
+            }
+        }
+    }
 }
@@ -0,0 +1,7 @@
+<?php
+
+namespace Example\ClassMap;
+
+class NotMapped
+{
+}
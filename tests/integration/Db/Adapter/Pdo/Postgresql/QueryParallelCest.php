@@ -0,0 +1,207 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Adapter\Pdo\Postgresql;
+
+use IntegrationTester;
+use PDO;
+use Phalcon\Db\Adapter\Pdo\Postgresql;
+use Phalcon\Db\Enum;
+use Phalcon\Db\Result\ArrayResult;
+use Phalcon\Test\Fixtures\Traits\Db\PostgresqlTrait;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+
+use function getOptionsPostgresql;
+
+/**
+ * Class QueryParallelCest
+ */
+class QueryParallelCest
+{
+    use DiTrait;
+    use PostgresqlTrait;
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Postgresql :: queryParallel()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoPostgresqlQueryParallel(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Postgresql - queryParallel()');
+
+        $I->checkExtensionIsLoaded('pgsql');
+
+        $I->assertTrue(
+            $this->connection->supportsParallelQueries()
+        );
+
+        $results = $this->connection->queryParallel(
+            [
+                'one' => ['SELECT 1 AS value'],
+                'two' => ['SELECT :value AS value', ['value' => 'two']],
+            ]
+        );
+
+        $I->assertEquals(['one', 'two'], array_keys($results));
+        $I->assertInstanceOf(ArrayResult::class, $results['one']);
+
+        $results['one']->setFetchMode(Enum::FETCH_ASSOC);
+        $results['two']->setFetchMode(Enum::FETCH_ASSOC);
+
+        $I->assertSame(['value' => 1], $results['one']->fetch());
+        $I->assertSame(['value' => 'two'], $results['two']->fetch());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Postgresql :: queryParallel() - literals
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoPostgresqlQueryParallelLiterals(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Postgresql - queryParallel() - literals');
+
+        $I->checkExtensionIsLoaded('pgsql');
+
+        $results = $this->connection->queryParallel(
+            [
+                'one' => [
+                    "SELECT :id AS value, 'a:id' AS literal, 'it''s :id' AS quoted",
+                    ['id' => 'one'],
+                ],
+                'two' => ['SELECT 2 AS value'],
+            ]
+        );
+
+        $results['one']->setFetchMode(Enum::FETCH_ASSOC);
+
+        $expected = [
+            'value'   => 'one',
+            'literal' => 'a:id',
+            'quoted'  => "it's :id",
+        ];
+        $I->assertSame($expected, $results['one']->fetch());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Postgresql :: queryParallel() - types
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoPostgresqlQueryParallelTypes(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Postgresql - queryParallel() - types');
+
+        $I->checkExtensionIsLoaded('pgsql');
+
+        $sql = "SELECT TRUE AS yes, FALSE AS no, NULL::boolean AS unknown, "
+            . "42::int8 AS number, 'text'::varchar AS name";
+
+        $results = $this->connection->queryParallel(
+            [
+                'parallel'   => [$sql],
+                'sequential' => ['SELECT 1'],
+            ]
+        );
+
+        $results['parallel']->setFetchMode(Enum::FETCH_ASSOC);
+
+        $row = $results['parallel']->fetch();
+
+        $I->assertSame(
+            [
+                'yes'     => true,
+                'no'      => false,
+                'unknown' => null,
+                'number'  => 42,
+                'name'    => 'text',
+            ],
+            $row
+        );
+
+        /**
+         * The same values as PDO
+         */
+        $I->assertSame(
+            $this->connection->fetchOne($sql, Enum::FETCH_ASSOC),
+            $row
+        );
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Postgresql :: queryParallel() - options
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoPostgresqlQueryParallelOptions(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Postgresql - queryParallel() - options');
+
+        $I->checkExtensionIsLoaded('pgsql');
+
+        /**
+         * PDO attributes that change the connection run the statements on
+         * the PDO connection
+         */
+        $connection = new Postgresql(
+            array_merge(
+                getOptionsPostgresql(),
+                [
+                    'options' => [
+                        PDO::ATTR_TIMEOUT => 5,
+                    ],
+                ]
+            )
+        );
+
+        $I->assertFalse($connection->supportsParallelQueries());
+
+        $results = $connection->queryParallel(
+            [
+                'one' => ['SELECT 1 AS value'],
+                'two' => ['SELECT 2 AS value'],
+            ]
+        );
+
+        $I->assertNotInstanceOf(ArrayResult::class, $results['one']);
+
+        $connection->close();
+
+        /**
+         * Closing the adapter closes the parallel connections too
+         */
+        $this->connection->queryParallel(
+            [
+                'one' => ['SELECT 1 AS value'],
+                'two' => ['SELECT 2 AS value'],
+            ]
+        );
+
+        $I->assertCount(
+            2,
+            $I->getProtectedProperty($this->connection, 'parallelConnections')
+        );
+
+        $I->assertTrue($this->connection->close());
+
+        $I->assertCount(
+            0,
+            $I->getProtectedProperty($this->connection, 'parallelConnections')
+        );
+    }
+}
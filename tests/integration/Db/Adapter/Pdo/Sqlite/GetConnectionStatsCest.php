@@ -0,0 +1,179 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Adapter\Pdo\Sqlite;
+
+use IntegrationTester;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\Enum;
+
+use function getOptionsSqlite;
+
+/**
+ * Class GetConnectionStatsCest
+ */
+class GetConnectionStatsCest
+{
+    public function _after(IntegrationTester $I)
+    {
+        Sqlite::clearConnectionPool();
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Sqlite :: getConnectionStats() - pooled
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoSqliteGetConnectionStatsPooled(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Sqlite - getConnectionStats() - pooled');
+
+        Sqlite::clearConnectionPool();
+
+        $before  = Sqlite::getConnectionStats();
+        $options = array_merge(
+            getOptionsSqlite(),
+            [
+                'pooled' => true,
+            ]
+        );
+
+        $first  = new Sqlite($options);
+        $second = new Sqlite($options);
+
+        $I->assertSame(
+            $first->getInternalHandler(),
+            $second->getInternalHandler()
+        );
+
+        $stats = Sqlite::getConnectionStats();
+
+        $I->assertEquals($before['connects'] + 1, $stats['connects']);
+        $I->assertEquals($before['reuses'] + 1, $stats['reuses']);
+        $I->assertEquals(1, $stats['pooled']);
+
+        /**
+         * Adapters that are not pooled get their own connection
+         */
+        $third = new Sqlite(getOptionsSqlite());
+
+        $I->assertNotSame(
+            $first->getInternalHandler(),
+            $third->getInternalHandler()
+        );
+
+        $stats = Sqlite::getConnectionStats();
+        $I->assertEquals($before['connects'] + 2, $stats['connects']);
+
+        Sqlite::clearConnectionPool();
+
+        $fourth = new Sqlite($options);
+
+        $I->assertNotSame(
+            $first->getInternalHandler(),
+            $fourth->getInternalHandler()
+        );
+
+        $stats = Sqlite::getConnectionStats();
+        $I->assertEquals($before['connects'] + 3, $stats['connects']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Sqlite :: getConnectionStats() - ping
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoSqliteGetConnectionStatsPing(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Sqlite - getConnectionStats() - ping');
+
+        $connection = new Sqlite(
+            array_merge(
+                getOptionsSqlite(),
+                [
+                    'pingInterval' => 0.05,
+                    'reconnect'    => true,
+                ]
+            )
+        );
+
+        $before = Sqlite::getConnectionStats();
+
+        /**
+         * Not idle yet
+         */
+        $connection->query('SELECT 1');
+
+        usleep(100000);
+
+        $I->assertEquals(
+            ['one' => 1],
+            $connection->fetchOne('SELECT 1 AS one', Enum::FETCH_ASSOC)
+        );
+
+        $stats = Sqlite::getConnectionStats();
+
+        $I->assertEquals($before['pings'] + 1, $stats['pings']);
+        $I->assertEquals($before['reconnects'], $stats['reconnects']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Sqlite :: getConnectionStats() - begin
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoSqliteGetConnectionStatsBegin(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Sqlite - getConnectionStats() - begin');
+
+        $options = array_merge(
+            getOptionsSqlite(),
+            [
+                'pooled'       => true,
+                'pingInterval' => 0.05,
+            ]
+        );
+
+        $first = new Sqlite($options);
+
+        $first->query('SELECT 1');
+
+        usleep(100000);
+
+        $before = Sqlite::getConnectionStats();
+
+        /**
+         * An idle connection is checked before the transaction starts
+         */
+        $I->assertTrue($first->begin());
+
+        $stats = Sqlite::getConnectionStats();
+        $I->assertEquals($before['pings'] + 1, $stats['pings']);
+
+        /**
+         * A pooled connection in a transaction is not shared
+         */
+        $second = new Sqlite($options);
+
+        $I->assertNotSame(
+            $first->getInternalHandler(),
+            $second->getInternalHandler()
+        );
+        $I->assertFalse($second->isUnderTransaction());
+
+        $first->rollback();
+    }
+}
@@ -0,0 +1,58 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Adapter\Pdo\Sqlite;
+
+use IntegrationTester;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\Enum;
+
+use function getOptionsSqlite;
+
+/**
+ * Class QueryParallelCest
+ */
+class QueryParallelCest
+{
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo\Sqlite :: queryParallel() - sequential
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPdoSqliteQueryParallel(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo\Sqlite - queryParallel() - sequential');
+
+        $connection = new Sqlite(getOptionsSqlite());
+
+        $I->assertFalse(
+            $connection->supportsParallelQueries()
+        );
+
+        $results = $connection->queryParallel(
+            [
+                'one' => ['SELECT 1 AS value'],
+                'two' => ['SELECT :value AS value', ['value' => 2]],
+            ]
+        );
+
+        $I->assertEquals(['one', 'two'], array_keys($results));
+
+        $results['one']->setFetchMode(Enum::FETCH_ASSOC);
+        $results['two']->setFetchMode(Enum::FETCH_ASSOC);
+
+        $I->assertEquals(1, $results['one']->fetch()['value']);
+        $I->assertEquals(2, $results['two']->fetch()['value']);
+    }
+}
@@ -0,0 +1,202 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Adapter\Pool;
+
+use Exception;
+use IntegrationTester;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\Adapter\Pool;
+
+use function getOptionsSqlite;
+
+/**
+ * Class GetReadAdapterCest
+ */
+class GetReadAdapterCest
+{
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: getReadAdapter()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolGetReadAdapter(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - getReadAdapter()');
+
+        $primary = new Sqlite(getOptionsSqlite());
+        $replica = new Sqlite(getOptionsSqlite());
+
+        $pool = new Pool($primary, [$replica]);
+
+        $I->assertSame($replica, $pool->getReadAdapter());
+        $I->assertSame($primary, $pool->getPrimary());
+        $I->assertFalse($pool->isSticky());
+
+        $status = $pool->getReplicaStatus();
+        $I->assertTrue($status[0]['active']);
+        $I->assertFalse($status[0]['ejected']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: getReadAdapter() - after a write
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolGetReadAdapterSticky(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - getReadAdapter() - sticky');
+
+        $primary = new Sqlite(getOptionsSqlite());
+        $replica = new Sqlite(getOptionsSqlite());
+
+        $pool = new Pool($primary, [$replica]);
+
+        $pool->begin();
+
+        $I->assertTrue($pool->isUnderTransaction());
+        $I->assertSame($primary, $pool->getReadAdapter());
+
+        $pool->rollback();
+
+        /**
+         * Reads stay on the primary after a write
+         */
+        $I->assertTrue($pool->isSticky());
+        $I->assertSame($primary, $pool->getReadAdapter());
+
+        $pool->setSticky(false);
+        $I->assertSame($replica, $pool->getReadAdapter());
+
+        /**
+         * Disabled stickiness
+         */
+        $pool = new Pool(
+            $primary,
+            [$replica],
+            [
+                'sticky' => false,
+            ]
+        );
+
+        $pool->execute('SELECT 1');
+
+        $I->assertFalse($pool->isSticky());
+        $I->assertSame($replica, $pool->getReadAdapter());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: getReadAdapter() - lazy replicas
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolGetReadAdapterClosure(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - getReadAdapter() - closure');
+
+        $primary = new Sqlite(getOptionsSqlite());
+        $calls   = 0;
+
+        $pool = new Pool(
+            $primary,
+            [
+                function () use (&$calls) {
+                    $calls++;
+
+                    return new Sqlite(getOptionsSqlite());
+                },
+            ]
+        );
+
+        /**
+         * Replicas are created when they are first needed
+         */
+        $I->assertEquals(0, $calls);
+
+        $replica = $pool->getReadAdapter();
+
+        $I->assertInstanceOf(Sqlite::class, $replica);
+        $I->assertNotSame($primary, $replica);
+        $I->assertSame($replica, $pool->getReadAdapter());
+        $I->assertEquals(1, $calls);
+
+        /**
+         * Replicas that cannot be created are ejected
+         */
+        $pool = new Pool(
+            $primary,
+            [
+                [
+                    'adapter' => function () {
+                        throw new Exception('Connection refused');
+                    },
+                    'weight'  => 2,
+                ],
+            ]
+        );
+
+        $I->assertSame($primary, $pool->getReadAdapter());
+
+        $status = $pool->getReplicaStatus();
+        $I->assertTrue($status[0]['ejected']);
+        $I->assertFalse($status[0]['active']);
+        $I->assertEquals(2, $status[0]['weight']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: getReadAdapter() - replication lag
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolGetReadAdapterLag(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - getReadAdapter() - lag');
+
+        $primary = new Sqlite(getOptionsSqlite());
+        $replica = new Sqlite(getOptionsSqlite());
+
+        $pool = new Pool(
+            $primary,
+            [$replica],
+            [
+                'maxLag'   => 5,
+                'lagQuery' => 'SELECT 10',
+            ]
+        );
+
+        $I->assertSame($primary, $pool->getReadAdapter());
+
+        $status = $pool->getReplicaStatus();
+        $I->assertTrue($status[0]['ejected']);
+        $I->assertEquals(10, $status[0]['lag']);
+
+        $pool = new Pool(
+            $primary,
+            [$replica],
+            [
+                'maxLag'   => 5,
+                'lagQuery' => 'SELECT 1',
+            ]
+        );
+
+        $I->assertSame($replica, $pool->getReadAdapter());
+
+        $status = $pool->getReplicaStatus();
+        $I->assertFalse($status[0]['ejected']);
+        $I->assertEquals(1, $status[0]['lag']);
+    }
+}
@@ -0,0 +1,134 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Adapter\Pool;
+
+use IntegrationTester;
+use Phalcon\Db\Adapter\AbstractAdapter;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\Adapter\Pool;
+use Phalcon\Db\Column;
+use Phalcon\Db\Enum;
+use PDO;
+
+use function getOptionsSqlite;
+
+/**
+ * Class QueryCest
+ */
+class QueryCest
+{
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: query()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolQuery(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - query()');
+
+        $primary = new Sqlite(getOptionsSqlite());
+        $replica = new Sqlite(getOptionsSqlite());
+
+        $pool = new Pool($primary, [$replica]);
+
+        $sql = 'SELECT 1 AS one';
+
+        $result = $pool->query($sql);
+        $I->assertEquals(['one' => 1], $result->fetch(PDO::FETCH_ASSOC));
+
+        $I->assertEquals($sql, $replica->getSQLStatement());
+        $I->assertEquals($sql, $pool->getSQLStatement());
+
+        /**
+         * Anything else goes to the primary
+         */
+        $sql = 'PRAGMA user_version';
+
+        $pool->query($sql);
+
+        $I->assertEquals($sql, $primary->getSQLStatement());
+        $I->assertEquals($sql, $pool->getSQLStatement());
+        $I->assertTrue($pool->isSticky());
+
+        $sql = 'SELECT 2 AS two';
+
+        $I->assertEquals(
+            ['two' => 2],
+            $pool->fetchOne($sql, Enum::FETCH_ASSOC)
+        );
+        $I->assertEquals($sql, $primary->getSQLStatement());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: fetchAll()/fetchOne() - bind types
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolFetchBindTypes(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - fetchAll()/fetchOne() - bind types');
+
+        $pool = new Pool(
+            new Sqlite(getOptionsSqlite()),
+            [
+                new Sqlite(getOptionsSqlite()),
+            ]
+        );
+
+        $sql   = 'SELECT :value AS value';
+        $types = ['value' => Column::BIND_PARAM_INT];
+
+        $I->assertEquals(
+            ['value' => 2],
+            $pool->fetchOne($sql, Enum::FETCH_ASSOC, ['value' => '2'], $types)
+        );
+        $I->assertEquals($types, $pool->getSQLBindTypes());
+
+        $I->assertEquals(
+            [['value' => 3]],
+            $pool->fetchAll($sql, Enum::FETCH_ASSOC, ['value' => '3'], $types)
+        );
+        $I->assertEquals($types, $pool->getSQLBindTypes());
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pool :: query() - locking reads
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbAdapterPoolQueryLockingRead(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pool - query() - locking reads');
+
+        $locking = [
+            'SELECT * FROM robots FOR UPDATE',
+            "SELECT * FROM robots\nFOR UPDATE",
+            'SELECT * FROM robots FOR SHARE',
+            'SELECT * FROM robots FOR NO KEY UPDATE',
+            "SELECT * FROM robots for  key\tshare",
+            'SELECT * FROM robots LOCK IN SHARE MODE',
+        ];
+
+        foreach ($locking as $sql) {
+            $I->assertTrue(AbstractAdapter::isLockingRead($sql));
+        }
+
+        $I->assertFalse(
+            AbstractAdapter::isLockingRead('SELECT * FROM robots_for_update')
+        );
+    }
+}
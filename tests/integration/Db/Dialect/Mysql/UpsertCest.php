@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Dialect\Mysql;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Mysql;
+
+class UpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Mysql :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbDialectMysqlUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Mysql - upsert()');
+
+        $dialect = new Mysql();
+
+        $I->assertEquals(
+            'INSERT INTO robots (id, name) VALUES (?, ?) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)',
+            $dialect->upsert('INSERT INTO robots (id, name) VALUES (?, ?)', ['id'], ['name'])
+        );
+
+        $I->assertEquals(
+            'INSERT INTO robots (id, name) VALUES (?, ?) ON DUPLICATE KEY UPDATE `id` = `id`',
+            $dialect->upsert('INSERT INTO robots (id, name) VALUES (?, ?)', ['id'], [])
+        );
+    }
+}
@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Dialect\Sqlite;
+
+use IntegrationTester;
+use Phalcon\Db\Dialect\Sqlite;
+
+class UpsertCest
+{
+    /**
+     * Tests Phalcon\Db\Dialect\Sqlite :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbDialectSqliteUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Dialect\Sqlite - upsert()');
+
+        $dialect = new Sqlite();
+
+        $I->assertEquals(
+            'INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"',
+            $dialect->upsert('INSERT INTO robots (id, name) VALUES (?, ?)', ['id'], ['name'])
+        );
+
+        $I->assertEquals(
+            'INSERT INTO robots (id, name) VALUES (?, ?) ON CONFLICT ("id") DO NOTHING',
+            $dialect->upsert('INSERT INTO robots (id, name) VALUES (?, ?)', ['id'], [])
+        );
+    }
+}
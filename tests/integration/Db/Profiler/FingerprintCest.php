@@ -0,0 +1,89 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Profiler;
+
+use Codeception\Example;
+use IntegrationTester;
+use Phalcon\Db\Profiler;
+
+class FingerprintCest
+{
+    /**
+     * Tests Phalcon\Db\Profiler :: fingerprint()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbProfilerFingerprint(IntegrationTester $I, Example $example)
+    {
+        $I->wantToTest('Db\Profiler - fingerprint() - ' . $example[0]);
+
+        $I->assertEquals(
+            $example[2],
+            Profiler::fingerprint($example[1])
+        );
+    }
+
+    /**
+     * Tests Phalcon\Db\Profiler :: getHistogramBucket()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbProfilerGetHistogramBucket(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Profiler - getHistogramBucket()');
+
+        foreach ([0.000001, 0.0001, 0.0123, 0.5, 2.75] as $seconds) {
+            $bucket = Profiler::getHistogramBucket($seconds);
+            $limit  = Profiler::getHistogramBucketLimit($bucket);
+
+            $I->assertGreaterThan($seconds, $limit);
+            $I->assertLessThanOrEqual($seconds * 1.25, $limit);
+        }
+
+        $I->assertLessThan(
+            Profiler::getHistogramBucket(0.002),
+            Profiler::getHistogramBucket(0.001)
+        );
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            [
+                'numbers',
+                'SELECT * FROM robots WHERE id = 10 AND year > 1952.5',
+                'SELECT * FROM robots WHERE id = ? AND year > ?',
+            ],
+            [
+                'strings',
+                "SELECT * FROM robots WHERE name = 'Astro Boy' AND type = 'it''s'",
+                'SELECT * FROM robots WHERE name = ? AND type = ?',
+            ],
+            [
+                'lists',
+                'SELECT * FROM robots WHERE id IN (1, 2, 3)',
+                'SELECT * FROM robots WHERE id IN (?+)',
+            ],
+            [
+                'identifiers',
+                "SELECT t1.id FROM robots2 t1\n   WHERE t1.id = :id:",
+                'SELECT t1.id FROM robots2 t1 WHERE t1.id = :id:',
+            ],
+        ];
+    }
+}
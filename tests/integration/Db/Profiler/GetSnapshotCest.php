@@ -0,0 +1,128 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Profiler;
+
+use IntegrationTester;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\Profiler;
+
+use function getOptionsSqlite;
+
+class GetSnapshotCest
+{
+    /**
+     * Tests Phalcon\Db\Profiler :: getSnapshot()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbProfilerGetSnapshot(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Profiler - getSnapshot()');
+
+        $profiler = new Profiler(
+            [
+                'aggregate'      => true,
+                'slowThreshold'  => 0,
+                'maxSlowQueries' => 2,
+            ]
+        );
+
+        $connection = new Sqlite(getOptionsSqlite());
+        $connection->setProfiler($profiler);
+
+        $I->assertSame($profiler, $connection->getProfiler());
+
+        $connection->query('SELECT 1');
+        $connection->query('SELECT 2');
+        $connection->query('SELECT ?', [3]);
+        $connection->execute('SELECT 4');
+
+        $snapshot = $profiler->getSnapshot();
+
+        $I->assertEquals(4, $snapshot['statements']);
+        $I->assertEquals(4, $snapshot['sampled']);
+        $I->assertEquals(4, $profiler->getNumberTotalStatements());
+        $I->assertEmpty($profiler->getProfiles());
+
+        $I->assertEquals(['SELECT ?'], array_keys($snapshot['fingerprints']));
+
+        $statistics = $snapshot['fingerprints']['SELECT ?'];
+
+        $I->assertEquals(4, $statistics['count']);
+        $I->assertEquals(4, array_sum($statistics['histogram']));
+        $I->assertGreaterThanOrEqual($statistics['min'], $statistics['max']);
+        $I->assertGreaterThanOrEqual($statistics['p50'], $statistics['p99']);
+
+        /**
+         * Only the slowest statements are kept
+         */
+        $I->assertCount(2, $snapshot['slowQueries']);
+        $I->assertEquals('SELECT ?', $snapshot['slowQueries'][0]['fingerprint']);
+
+        $profiler->reset();
+
+        $snapshot = $profiler->getSnapshot();
+
+        $I->assertEquals(0, $snapshot['statements']);
+        $I->assertEquals([], $snapshot['fingerprints']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Profiler :: getSnapshot() - limits
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbProfilerGetSnapshotLimits(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Profiler - getSnapshot() - limits');
+
+        $profiler = new Profiler(
+            [
+                'aggregate'       => true,
+                'maxFingerprints' => 1,
+                'sampleRate'      => 0.0,
+            ]
+        );
+
+        $profiler->startQuery('SELECT 1');
+        $profiler->stopQuery(1);
+
+        $snapshot = $profiler->getSnapshot();
+
+        $I->assertEquals(1, $snapshot['statements']);
+        $I->assertEquals(0, $snapshot['sampled']);
+
+        $profiler = new Profiler(
+            [
+                'aggregate'       => true,
+                'maxFingerprints' => 1,
+            ]
+        );
+
+        $profiler->startQuery('SELECT 1');
+        $profiler->stopQuery(1);
+        $profiler->startQuery('SELECT * FROM robots');
+        $profiler->stopQuery(3);
+
+        $snapshot = $profiler->getSnapshot();
+
+        $I->assertEquals(
+            ['SELECT ?', '(other)'],
+            array_keys($snapshot['fingerprints'])
+        );
+        $I->assertEquals(3, $snapshot['fingerprints']['(other)']['rows']);
+    }
+}
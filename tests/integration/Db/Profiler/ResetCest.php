@@ -79,8 +79,18 @@ class ResetCest
             $profiler->getPoints()
         );
 
+        $totalSeconds = $profiler->getTotalElapsedSeconds();
+
         $profiler->reset();
 
+        /**
+         * The total time is kept
+         */
+        $I->assertEquals(
+            $totalSeconds,
+            $profiler->getTotalElapsedSeconds()
+        );
+
         $I->assertCount(
             0,
             $profiler->getProfiles()
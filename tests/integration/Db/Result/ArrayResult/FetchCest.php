@@ -0,0 +1,98 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Db\Result\ArrayResult;
+
+use IntegrationTester;
+use Phalcon\Db\Enum;
+use Phalcon\Db\Result\ArrayResult;
+
+/**
+ * Class FetchCest
+ */
+class FetchCest
+{
+    /**
+     * Tests Phalcon\Db\Result\ArrayResult :: fetch()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbResultArrayResultFetch(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Result\ArrayResult - fetch()');
+
+        $result = new ArrayResult(
+            [
+                ['id' => 1, 'name' => 'Robotina'],
+                ['id' => 2, 'name' => 'Astro Boy'],
+            ]
+        );
+
+        $I->assertEquals(2, $result->numRows());
+
+        $I->assertEquals(
+            ['id' => 1, 'name' => 'Robotina'],
+            $result->fetch()
+        );
+
+        $result->setFetchMode(Enum::FETCH_NUM);
+
+        $I->assertEquals(
+            [2, 'Astro Boy'],
+            $result->fetch()
+        );
+
+        $I->assertFalse(
+            $result->fetch()
+        );
+
+        $result->dataSeek(1);
+        $result->setFetchMode(Enum::FETCH_OBJ);
+
+        $robot = $result->fetch();
+
+        $I->assertEquals('Astro Boy', $robot->name);
+    }
+
+    /**
+     * Tests Phalcon\Db\Result\ArrayResult :: fetchAll()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function dbResultArrayResultFetchAll(IntegrationTester $I)
+    {
+        $I->wantToTest('Db\Result\ArrayResult - fetchAll()');
+
+        $rows = [
+            ['id' => 1, 'name' => 'Robotina'],
+            ['id' => 2, 'name' => 'Astro Boy'],
+        ];
+
+        $result = new ArrayResult($rows);
+
+        $I->assertEquals($rows, $result->fetchAll());
+        $I->assertEquals([], $result->fetchAll());
+
+        $result->execute();
+
+        $I->assertEquals(
+            [
+                [1, 'Robotina'],
+                [2, 'Astro Boy'],
+            ],
+            $result->fetchAll(Enum::FETCH_NUM)
+        );
+    }
+}
@@ -0,0 +1,164 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Forms\Form;
+
+use IntegrationTester;
+use Phalcon\Forms\Element\Text;
+use Phalcon\Forms\Form;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Validation;
+use Phalcon\Validation\Validator\PresenceOf;
+use Phalcon\Validation\Validator\Regex;
+
+class CompileCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newDi();
+        $this->setDiEscaper();
+        $this->setDiUrl();
+    }
+
+    /**
+     * Tests Phalcon\Forms\Form :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function formsFormCompile(IntegrationTester $I)
+    {
+        $I->wantToTest('Forms\Form - compile()');
+
+        $form = $this->getForm();
+        $plan = $form->compile();
+
+        $I->assertCount(2, $plan['rules']);
+
+        /**
+         * Validating several times does not append the element validators
+         * again
+         */
+        $I->assertFalse(
+            $form->isValid(
+                [
+                    'telephone' => '12345',
+                ]
+            )
+        );
+
+        $I->assertTrue(
+            $form->isValid(
+                [
+                    'telephone' => '+44 123 45678',
+                ]
+            )
+        );
+
+        $I->assertCount(
+            1,
+            $form->getValidation()->getValidators()['telephone']
+        );
+
+        /**
+         * Adding or removing elements discards the plan
+         */
+        $form->add(new Text('name'));
+
+        $I->assertNull($form->getPlan());
+
+        $form->compile();
+        $form->remove('name');
+
+        $I->assertNull($form->getPlan());
+
+        $form->compile();
+        $form->setValidation(new Validation());
+
+        $I->assertNull($form->getPlan());
+    }
+
+    /**
+     * Tests Phalcon\Forms\Form :: setPlan()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function formsFormSetPlan(IntegrationTester $I)
+    {
+        $I->wantToTest('Forms\Form - setPlan()');
+
+        $plan = $this->getForm()->compile();
+
+        $form = new Form();
+
+        $form->add(
+            new Text('telephone')
+        );
+
+        $form->setPlan($plan);
+
+        $I->assertFalse(
+            $form->isValid([])
+        );
+
+        $messages = $form->getMessagesFor('telephone');
+
+        $I->assertCount(2, $messages);
+
+        $I->assertEquals(
+            'The telephone has an invalid format',
+            $messages[0]->getMessage()
+        );
+
+        $I->assertEquals(
+            'The telephone is required',
+            $messages[1]->getMessage()
+        );
+    }
+
+    private function getForm(): Form
+    {
+        $telephone = new Text('telephone');
+
+        $telephone->addValidator(
+            new PresenceOf(
+                [
+                    'message'      => 'The telephone is required',
+                    'cancelOnFail' => true,
+                ]
+            )
+        );
+
+        $validation = new Validation();
+
+        $validation->add(
+            'telephone',
+            new Regex(
+                [
+                    'pattern' => '/\+44 [0-9]+ [0-9]+/',
+                    'message' => 'The telephone has an invalid format',
+                ]
+            )
+        );
+
+        $form = new Form();
+
+        $form->setValidation($validation);
+        $form->add($telephone);
+
+        return $form;
+    }
+}
@@ -0,0 +1,220 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Model;
+
+use IntegrationTester;
+use Phalcon\Db\Column;
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Robots;
+
+/**
+ * Class CloneResultHydratorCest
+ */
+class CloneResultHydratorCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: cloneResultHydrator()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCloneResultHydrator(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - cloneResultHydrator()');
+
+        $columnMap = [
+            'id'       => ['code', Column::TYPE_INTEGER],
+            'name'     => ['theName', Column::TYPE_VARCHAR],
+            'datetime' => ['theDatetime', Column::TYPE_DATETIME],
+            'deleted'  => ['theDeleted', Column::TYPE_DATETIME],
+            'text'     => ['theText', Column::TYPE_TEXT],
+            'type'     => ['theType', Column::TYPE_VARCHAR],
+            'year'     => ['theYear', Column::TYPE_INTEGER],
+        ];
+
+        $rows = [
+            [
+                'id'       => '1',
+                'name'     => 'Robotina',
+                'datetime' => '1972-01-01 00:00:00',
+                'deleted'  => null,
+                'text'     => 'text',
+                'type'     => 'mechanical',
+                'year'     => '1972',
+            ],
+            [
+                'id'       => '2',
+                'name'     => 'Astro Boy',
+                'datetime' => '1952-01-01 00:00:00',
+                'deleted'  => null,
+                'text'     => 'text',
+                'type'     => 'mechanical',
+                'year'     => '',
+            ],
+        ];
+
+        $hydrator = Model::compileHydrator($columnMap, $rows[0]);
+
+        $I->assertCount(7, $hydrator);
+        $I->assertEquals(['id', 'code', 1], $hydrator[0]);
+        $I->assertEquals(['name', 'theName', 0], $hydrator[1]);
+
+        $base = new Robots();
+
+        $robot = Model::cloneResultHydrator(
+            $base,
+            $rows[0],
+            $hydrator,
+            $columnMap,
+            Model::DIRTY_STATE_PERSISTENT
+        );
+
+        $I->assertInstanceOf(Robots::class, $robot);
+        $I->assertNotSame($base, $robot);
+        $I->assertEquals(Model::DIRTY_STATE_PERSISTENT, $robot->getDirtyState());
+        $I->assertSame(1, $robot->code);
+        $I->assertSame('Robotina', $robot->theName);
+        $I->assertSame(1972, $robot->theYear);
+        $I->assertNull($robot->theDeleted);
+
+        /**
+         * The same hydrator is used for every row of the resultset
+         */
+        $robot = Model::cloneResultHydrator(
+            $base,
+            $rows[1],
+            $hydrator,
+            $columnMap,
+            Model::DIRTY_STATE_PERSISTENT
+        );
+
+        $I->assertSame(2, $robot->code);
+        $I->assertSame('Astro Boy', $robot->theName);
+        $I->assertNull($robot->theYear);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: cloneResultHydrator() - no column map
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCloneResultHydratorNoColumnMap(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - cloneResultHydrator() - no column map');
+
+        $row = [
+            'id'   => '1',
+            'name' => 'Robotina',
+            0      => 'ignored',
+        ];
+
+        $hydrator = Model::compileHydrator(null, $row);
+
+        $I->assertEquals(
+            [
+                ['id', 'id', 0],
+                ['name', 'name', 0],
+            ],
+            $hydrator
+        );
+
+        $robot = Model::cloneResultHydrator(new Robots(), $row, $hydrator, null);
+
+        $I->assertSame('1', $robot->id);
+        $I->assertSame('Robotina', $robot->name);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: compileHydrator() - unknown column
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCompileHydratorUnknownColumn(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - compileHydrator() - unknown column');
+
+        $I->expectThrowable(
+            new Exception(
+                "Column 'unknown' doesn't make part of the column map"
+            ),
+            function () {
+                Model::compileHydrator(
+                    [
+                        'id' => 'code',
+                    ],
+                    [
+                        'id'      => '1',
+                        'unknown' => 'value',
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Resultset\Simple - hydration through the
+     * compiled hydrator
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCloneResultHydratorResultset(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - cloneResultHydrator() - resultset');
+
+        Model::setup(
+            [
+                'castOnHydrate' => true,
+            ]
+        );
+
+        $robots = Robots::find(
+            [
+                'order' => 'id',
+                'limit' => 3,
+            ]
+        );
+
+        Model::setup(
+            [
+                'castOnHydrate' => false,
+            ]
+        );
+
+        $I->assertCount(3, $robots);
+
+        foreach ($robots as $robot) {
+            $I->assertInstanceOf(Robots::class, $robot);
+            $I->assertInternalType('int', $robot->id);
+            $I->assertInternalType('int', $robot->year);
+        }
+    }
+}
@@ -14,8 +14,10 @@ declare(strict_types=1);
 namespace Phalcon\Test\Integration\Mvc\Model;
 
 use IntegrationTester;
+use Phalcon\Db\Adapter\Pool;
 use Phalcon\Test\Fixtures\Traits\DiTrait;
 use Phalcon\Test\Models\AlbumORama\Artists;
+use Phalcon\Test\Models\Robots;
 
 use function uniqid;
 
@@ -66,4 +68,35 @@ class CreateCest
 
         $I->assertNotFalse($result);
     }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: create() - connection pool
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCreatePool(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - create() - connection pool');
+
+        $this->setNewFactoryDefault();
+
+        $primary = $this->newDiMysql();
+        $replica = $this->newDiMysql();
+
+        $this->container->setShared(
+            'db',
+            new Pool($primary, [$replica])
+        );
+
+        /**
+         * The existence check runs on the primary
+         */
+        $robot     = new Robots();
+        $robot->id = 1;
+
+        $I->assertFalse($robot->create());
+        $I->assertContains('COUNT(*)', $primary->getSQLStatement());
+        $I->assertEmpty($replica->getSQLStatement());
+    }
 }
@@ -14,21 +14,80 @@ declare(strict_types=1);
 namespace Phalcon\Test\Integration\Mvc\Model;
 
 use IntegrationTester;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Snapshot\Robots;
+use Phalcon\Test\Models\Snapshot\Robotters;
 
 /**
  * Class GetSnapshotDataCest
  */
 class GetSnapshotDataCest
 {
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
     /**
      * Tests Phalcon\Mvc\Model :: getSnapshotData()
      *
      * @author Phalcon Team <team@phalcon.io>
-     * @since  2018-11-13
+     * @since  2020-01-20
      */
     public function mvcModelGetSnapshotData(IntegrationTester $I)
     {
         $I->wantToTest('Mvc\Model - getSnapshotData()');
-        $I->skipTest('Need implementation');
+
+        $robot = Robots::findFirst(1);
+
+        $I->assertTrue($robot->hasSnapshotData());
+
+        $expected = $robot->toArray();
+        $actual   = $robot->getSnapshotData();
+        $I->assertEquals($expected, $actual);
+
+        $I->assertEquals($actual, $robot->getOldSnapshotData());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: getSnapshotData() - column map
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelGetSnapshotDataColumnMap(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - getSnapshotData() - column map');
+
+        $robot = Robotters::findFirst(1);
+
+        /**
+         * The snapshot is built from the row when it is used
+         */
+        $I->assertTrue($robot->hasSnapshotData());
+        $I->assertEquals([], $robot->getChangedFields());
+
+        $robot->theName = 'Changed';
+
+        $expected = ['theName'];
+        $actual   = $robot->getChangedFields();
+        $I->assertEquals($expected, $actual);
+
+        $snapshot = $robot->getSnapshotData();
+
+        $I->assertArrayHasKey('code', $snapshot);
+        $I->assertArrayHasKey('theName', $snapshot);
+        $I->assertArrayNotHasKey('name', $snapshot);
+        $I->assertNotEquals('Changed', $snapshot['theName']);
+
+        $I->assertEquals($snapshot, $robot->getOldSnapshotData());
     }
 }
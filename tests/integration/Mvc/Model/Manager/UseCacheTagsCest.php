@@ -0,0 +1,228 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Model\Manager;
+
+use IntegrationTester;
+use Phalcon\Mvc\Model\Manager;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Robots;
+
+/**
+ * Class UseCacheTagsCest
+ */
+class UseCacheTagsCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useCacheTags()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseCacheTags(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useCacheTags()');
+
+        $cache = $this->getAndSetModelsCacheStream();
+        $cache->clear();
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+
+        $I->assertFalse($manager->isUsingCacheTags());
+
+        $manager->useCacheTags(true);
+
+        $I->assertTrue($manager->isUsingCacheTags());
+
+        $options = [
+            'order' => 'id',
+            'cache' => [
+                'lifetime' => 60,
+            ],
+        ];
+
+        $robots = Robots::find($options);
+        $number = $robots->count();
+
+        $I->assertTrue($robots->isFresh());
+
+        $robots = Robots::find($options);
+
+        $I->assertFalse($robots->isFresh());
+        $I->assertCount($number, $robots);
+
+        /**
+         * Saving a record gives the table a new version
+         */
+        $robot           = new Robots();
+        $robot->name     = 'Tagged robot';
+        $robot->type     = 'tagged';
+        $robot->year     = 2020;
+        $robot->datetime = '2020-01-20 10:00:00';
+        $robot->text     = 'Tagged robot';
+
+        $I->assertTrue(
+            $robot->create()
+        );
+
+        $robots = Robots::find($options);
+
+        $I->assertTrue($robots->isFresh());
+        $I->assertCount($number + 1, $robots);
+
+        /**
+         * PHQL DELETE
+         */
+        $manager->executeQuery(
+            'DELETE FROM ' . Robots::class . " WHERE type = 'tagged'"
+        );
+
+        $robots = Robots::find($options);
+
+        $I->assertTrue($robots->isFresh());
+        $I->assertCount($number, $robots);
+
+        $manager->useCacheTags(false);
+        $cache->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: invalidateCacheTags()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerInvalidateCacheTags(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - invalidateCacheTags()');
+
+        $cache = $this->getAndSetModelsCacheStream();
+        $cache->clear();
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useCacheTags(true);
+
+        $I->assertEquals(
+            'robots',
+            $manager->getCacheTag(new Robots())
+        );
+
+        $versions = $manager->getCacheTagVersions(['robots']);
+
+        $I->assertEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        /**
+         * Held invalidations are applied once, on release
+         */
+        $manager->holdCacheTags();
+        $manager->invalidateCacheTags(['robots']);
+
+        $I->assertEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        $manager->releaseCacheTags();
+
+        $I->assertNotEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        $manager->useCacheTags(false);
+        $cache->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useCacheTags() - transactions
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseCacheTagsTransaction(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useCacheTags() - transactions');
+
+        $cache = $this->getAndSetModelsCacheStream();
+        $cache->clear();
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useCacheTags(true);
+
+        $versions = $manager->getCacheTagVersions(['robots']);
+
+        /**
+         * Rolled back changes never invalidate the tags
+         */
+        $transaction = $this->container->getShared('transactionManager')->get();
+
+        $robot = Robots::findFirst(1);
+        $robot->setTransaction($transaction);
+
+        $I->assertTrue($robot->save());
+        $I->assertEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        $transaction->rollback();
+
+        $I->assertEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        /**
+         * Committed changes invalidate them once the transaction ends
+         */
+        $transaction = $this->container->getShared('transactionManager')->get();
+
+        $robot = Robots::findFirst(1);
+        $robot->setTransaction($transaction);
+
+        $I->assertTrue($robot->save());
+        $I->assertEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        $transaction->commit();
+
+        $I->assertNotEquals(
+            $versions,
+            $manager->getCacheTagVersions(['robots'])
+        );
+
+        $manager->useCacheTags(false);
+        $cache->clear();
+    }
+}
@@ -0,0 +1,149 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Model\Manager;
+
+use IntegrationTester;
+use Phalcon\Mvc\Model\Manager;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Robots;
+use Phalcon\Test\Models\RobotsParts;
+
+/**
+ * Class UseIdentityMapCest
+ */
+class UseIdentityMapCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseIdentityMap(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap()');
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+
+        $I->assertFalse($manager->isUsingIdentityMap());
+
+        $manager->useIdentityMap(true);
+
+        $I->assertTrue($manager->isUsingIdentityMap());
+
+        $robot = Robots::findFirst(1);
+
+        $I->assertSame($robot, Robots::findFirst(1));
+        $I->assertSame($robot, Robots::findFirst('1'));
+        $I->assertSame($robot, $manager->getIdentityMapRecord(Robots::class, 1));
+
+        $expected = [
+            'hits'    => 3,
+            'misses'  => 1,
+            'records' => 1,
+        ];
+        $I->assertEquals($expected, $manager->getIdentityMapStats());
+
+        $manager->useIdentityMap(false);
+
+        $I->assertNotSame($robot, Robots::findFirst(1));
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap() - belongsTo
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseIdentityMapBelongsTo(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap() - belongsTo');
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useIdentityMap(true);
+
+        $robotPart = RobotsParts::findFirst();
+        $robot     = $robotPart->getRelated('robot');
+
+        $I->assertInstanceOf(Robots::class, $robot);
+        $I->assertSame($robot, Robots::findFirst($robotPart->robots_id));
+        $I->assertSame($robot, $robotPart->getRelated('robot'));
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap() - save
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseIdentityMapSave(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap() - save');
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useIdentityMap(true);
+
+        $robot = Robots::findFirst(1);
+
+        $I->assertTrue($robot->save());
+        $I->assertNull($manager->getIdentityMapRecord(Robots::class, 1));
+        $I->assertNotSame($robot, Robots::findFirst(1));
+
+        $manager->clearIdentityMap(Robots::class);
+
+        $expected = 0;
+        $actual   = $manager->getIdentityMapStats()['records'];
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: useIdentityMap() - changed primary key
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelManagerUseIdentityMapChangedKey(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - useIdentityMap() - changed primary key');
+
+        /** @var Manager $manager */
+        $manager = $this->container->getShared('modelsManager');
+        $manager->useIdentityMap(true);
+
+        $robot     = Robots::findFirst(1);
+        $robot->id = 999;
+
+        $I->assertNull($manager->getIdentityMapRecord(Robots::class, 1));
+
+        $expected = 0;
+        $actual   = $manager->getIdentityMapStats()['records'];
+        $I->assertEquals($expected, $actual);
+    }
+}
@@ -0,0 +1,145 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Model\Query;
+
+use IntegrationTester;
+use Phalcon\Mvc\Model\Query;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Robots;
+
+/**
+ * Class ExecuteParallelCest
+ */
+class ExecuteParallelCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: executeParallel()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelQueryExecuteParallel(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - executeParallel()');
+
+        $manager = $this->getService('modelsManager');
+
+        $robots = $manager->createQuery(
+            'SELECT * FROM ' . Robots::class . ' ORDER BY id'
+        );
+
+        $robot = $manager->createQuery(
+            'SELECT * FROM ' . Robots::class . ' WHERE id = :id:'
+        );
+        $robot->setBindParams(['id' => 1]);
+        $robot->setUniqueRow(true);
+
+        $count = $manager->createQuery(
+            'SELECT COUNT(*) AS total FROM ' . Robots::class
+        );
+        $count->setUniqueRow(true);
+
+        $results = Query::executeParallel(
+            [
+                'robots' => $robots,
+                'robot'  => $robot,
+                'count'  => $count,
+            ]
+        );
+
+        $I->assertEquals(
+            ['robots', 'robot', 'count'],
+            array_keys($results)
+        );
+
+        $expected = Robots::find(['order' => 'id']);
+
+        $I->assertCount(
+            $expected->count(),
+            $results['robots']
+        );
+
+        $I->assertEquals(
+            $expected->getFirst()->name,
+            $results['robots']->getFirst()->name
+        );
+
+        $I->assertInstanceOf(Robots::class, $results['robot']);
+        $I->assertEquals(1, $results['robot']->id);
+
+        $I->assertEquals(
+            $expected->count(),
+            $results['count']->total
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: executeParallel() - failure
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelQueryExecuteParallelFailure(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - executeParallel() - failure');
+
+        $manager = $this->getService('modelsManager');
+
+        $robots = $manager->createQuery(
+            'SELECT * FROM ' . Robots::class . ' ORDER BY id'
+        );
+
+        $failing = $manager->createQuery(
+            'SELECT phalcon_undefined_function(id) AS value FROM ' . Robots::class
+        );
+
+        $thrown = false;
+
+        try {
+            Query::executeParallel(
+                [
+                    'robots'  => $robots,
+                    'failing' => $failing,
+                ]
+            );
+        } catch (\Exception $e) {
+            $thrown = true;
+        }
+
+        $I->assertTrue($thrown);
+
+        /**
+         * No result is left behind for the next execution
+         */
+        $I->assertNull(
+            $I->getProtectedProperty($robots, 'prefetchedResult')
+        );
+        $I->assertNull(
+            $I->getProtectedProperty($failing, 'prefetchedResult')
+        );
+    }
+}
@@ -0,0 +1,142 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Model;
+
+use IntegrationTester;
+use Phalcon\Db\Adapter\AdapterInterface;
+use Phalcon\Events\Event;
+use Phalcon\Mvc\Model;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\AlbumORama\Artists;
+
+use function uniqid;
+
+/**
+ * Class UpsertCest
+ */
+class UpsertCest
+{
+    use DiTrait;
+
+    /**
+     * @var array
+     */
+    private $statements = [];
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->statements = [];
+
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+
+        $manager = $this->newEventsManager();
+        $manager->attach(
+            'db:beforeQuery',
+            function (Event $event, AdapterInterface $connection) {
+                $this->statements[] = $connection->getSQLStatement();
+            }
+        );
+
+        $this->container->get('db')->setEventsManager($manager);
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        Model::setup(
+            [
+                'explicitIntent' => false,
+            ]
+        );
+
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: upsert()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelUpsert(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - upsert()');
+
+        $artist       = new Artists();
+        $artist->name = uniqid();
+
+        $I->assertTrue($artist->upsert());
+        $I->assertGreaterThan(0, $artist->id);
+
+        $copy       = new Artists();
+        $copy->id   = $artist->id;
+        $copy->name = 'upserted';
+
+        $I->assertTrue($copy->upsert());
+        $I->assertEquals($artist->id, $copy->id);
+
+        $I->assertEquals(
+            'upserted',
+            Artists::findFirst($artist->id)->name
+        );
+
+        foreach ($this->statements as $statement) {
+            $I->assertStringNotContainsString('"rowcount"', $statement);
+        }
+
+        $I->assertTrue($copy->delete());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: create() - explicit intent
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function mvcModelCreateExplicitIntent(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Model - create() - explicit intent');
+
+        Model::setup(
+            [
+                'explicitIntent' => true,
+            ]
+        );
+
+        $artist       = new Artists();
+        $artist->name = uniqid();
+
+        $I->assertTrue($artist->create());
+
+        $artist->name = 'updated';
+
+        $I->assertTrue($artist->update());
+
+        $hydrated = Model::cloneResult(
+            new Artists(),
+            [
+                'id'   => $artist->id,
+                'name' => 'hydrated',
+            ]
+        );
+
+        $I->assertTrue($hydrated->save());
+
+        foreach ($this->statements as $statement) {
+            $I->assertStringNotContainsString('"rowcount"', $statement);
+        }
+
+        $I->assertTrue($artist->delete());
+    }
+}
@@ -0,0 +1,148 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Paginator\Adapter\Keyset;
+
+use IntegrationTester;
+use Phalcon\Paginator\Adapter\Keyset;
+use Phalcon\Paginator\Exception;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Robots;
+
+class PaginateCest
+{
+    use DiTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDiMysql();
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $this->container['db']->close();
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function paginatorAdapterKeysetPaginate(IntegrationTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate()');
+
+        $expected = [];
+
+        foreach (Robots::find(['order' => 'year, id']) as $robot) {
+            $expected[] = (int) $robot->id;
+        }
+
+        $builder = $this->getService('modelsManager')
+            ->createBuilder()
+            ->from(Robots::class)
+        ;
+
+        $paginator = new Keyset(
+            [
+                'builder' => $builder,
+                'limit'   => 2,
+                'keys'    => ['year', 'id'],
+                'count'   => true,
+            ]
+        );
+
+        /**
+         * Forward
+         */
+        $ids    = [];
+        $cursor = null;
+        $pages  = 0;
+
+        do {
+            $page = $paginator->setCursor($cursor)->paginate();
+
+            $I->assertEquals(count($expected), $page->getTotalItems());
+            $I->assertLessThanOrEqual(2, count($page->getItems()));
+
+            foreach ($page->getItems() as $robot) {
+                $ids[] = (int) $robot->id;
+            }
+
+            if (0 === $pages) {
+                $I->assertNull($page->getPreviousCursor());
+            }
+
+            $cursor = $page->getNextCursor();
+            $pages++;
+        } while (null !== $cursor);
+
+        $I->assertEquals($expected, $ids);
+        $I->assertEquals((int) ceil(count($expected) / 2), $pages);
+
+        /**
+         * Backward from the last page
+         */
+        $previous = $page->getPreviousCursor();
+
+        if (null !== $previous) {
+            $page = $paginator->setCursor($previous)->paginate();
+
+            $I->assertEquals(
+                array_slice($expected, ($pages - 2) * 2, 2),
+                array_map(
+                    function ($robot) {
+                        return (int) $robot->id;
+                    },
+                    $page->getItems()
+                )
+            );
+
+            $I->assertNotNull($page->getNextCursor());
+        }
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - invalid cursor
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function paginatorAdapterKeysetPaginateInvalidCursor(IntegrationTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - invalid cursor');
+
+        $I->expectThrowable(
+            new Exception('The cursor is not valid'),
+            function () {
+                $builder = $this->getService('modelsManager')
+                    ->createBuilder()
+                    ->from(Robots::class)
+                ;
+
+                $paginator = new Keyset(
+                    [
+                        'builder' => $builder,
+                        'limit'   => 2,
+                        'keys'    => 'id',
+                        'cursor'  => 'not-a-cursor',
+                    ]
+                );
+
+                $paginator->paginate();
+            }
+        );
+    }
+}
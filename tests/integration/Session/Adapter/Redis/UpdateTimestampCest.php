@@ -0,0 +1,89 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Session\Adapter\Redis;
+
+use IntegrationTester;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Fixtures\Traits\SessionTrait;
+
+use function uniqid;
+
+class UpdateTimestampCest
+{
+    use DiTrait;
+    use SessionTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newFactoryDefault();
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: write() - new empty session
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionAdapterRedisWriteNewEmptySession(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - write() - new empty session');
+        $adapter = $this->getSessionRedis();
+        $id      = uniqid('new-');
+
+        $I->assertEquals('', $adapter->read($id));
+
+        /**
+         * Unchanged, but there is no key to extend yet
+         */
+        $I->assertTrue(
+            $adapter->write($id, '')
+        );
+        $I->assertTrue(
+            $adapter->validateId($id)
+        );
+
+        $adapter->destroy($id);
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Redis :: write() - key expired during the
+     * request
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionAdapterRedisWriteExpiredKey(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Redis - write() - expired key');
+        $adapter = $this->getSessionRedis();
+        $id      = uniqid('expired-');
+        $value   = uniqid();
+
+        $adapter->write($id, $value);
+
+        $I->assertEquals($value, $adapter->read($id));
+
+        /**
+         * The key disappears while the request is running
+         */
+        $this->getSessionRedis()->destroy($id);
+
+        $I->assertTrue(
+            $adapter->write($id, $value)
+        );
+        $I->assertEquals($value, $adapter->read($id));
+
+        $adapter->destroy($id);
+    }
+}
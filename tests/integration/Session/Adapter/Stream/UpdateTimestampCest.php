@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Session\Adapter\Stream;
+
+use IntegrationTester;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Fixtures\Traits\SessionTrait;
+
+use function cacheDir;
+use function file_get_contents;
+use function file_put_contents;
+use function uniqid;
+
+class UpdateTimestampCest
+{
+    use DiTrait;
+    use SessionTrait;
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->newFactoryDefault();
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: updateTimestamp()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionAdapterStreamUpdateTimestamp(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - updateTimestamp()');
+        $adapter = $this->getSessionStream();
+        $value   = uniqid();
+        $adapter->write('test1', $value);
+
+        $I->assertTrue(
+            $adapter->updateTimestamp('test1', $value)
+        );
+
+        $I->amInPath(cacheDir('sessions'));
+        $I->seeFileFound('test1');
+        $I->seeInThisFile($value);
+        $I->safeDeleteFile(cacheDir('sessions/test1'));
+    }
+
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: write() - unchanged data is
+     * not written again
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionAdapterStreamWriteUnchanged(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - write() - unchanged');
+        $adapter = $this->getSessionStream();
+        $file    = cacheDir('sessions/test1');
+        $value   = uniqid();
+
+        file_put_contents($file, $value);
+
+        $I->assertEquals($value, $adapter->read('test1'));
+
+        /**
+         * Change the file behind the adapter's back. Writing the same payload
+         * that was read must leave it alone
+         */
+        file_put_contents($file, 'changed');
+
+        $I->assertTrue(
+            $adapter->write('test1', $value)
+        );
+        $I->assertEquals('changed', file_get_contents($file));
+
+        $I->assertTrue(
+            $adapter->write('test1', 'new')
+        );
+        $I->assertEquals('new', file_get_contents($file));
+
+        $I->safeDeleteFile($file);
+    }
+}
@@ -0,0 +1,130 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Session\Manager;
+
+use IntegrationTester;
+use Phalcon\Session\Exception;
+use Phalcon\Session\Manager;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Fixtures\Traits\SessionTrait;
+
+class StartCest
+{
+    use DiTrait;
+    use SessionTrait;
+
+    /**
+     * Tests Phalcon\Session\Manager :: start() - lazy
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionManagerStartLazy(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Manager - start() - lazy');
+
+        $manager = new Manager(
+            [
+                'lazy' => true,
+            ]
+        );
+
+        $manager->setAdapter(
+            $this->getSessionStream()
+        );
+
+        $I->assertTrue(
+            $manager->start()
+        );
+
+        $I->assertFalse(
+            $manager->exists()
+        );
+
+        /**
+         * No session cookie - reading does not start the session
+         */
+        $I->assertNull(
+            $manager->get('test')
+        );
+
+        $I->assertFalse(
+            $manager->exists()
+        );
+
+        $manager->set('test', 'myval');
+
+        $I->assertTrue(
+            $manager->exists()
+        );
+
+        $I->assertEquals(
+            'myval',
+            $manager->get('test')
+        );
+
+        $manager->destroy();
+
+        $I->assertFalse(
+            $manager->exists()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Session\Manager :: start() - read only
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function sessionManagerStartReadOnly(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Manager - start() - read only');
+
+        $manager = new Manager(
+            [
+                'readOnly' => true,
+            ]
+        );
+
+        $manager->setAdapter(
+            $this->getSessionStream()
+        );
+
+        $I->assertTrue(
+            $manager->start()
+        );
+
+        $I->assertTrue(
+            $manager->isReadOnly()
+        );
+
+        /**
+         * The lock is released straight away
+         */
+        $I->assertFalse(
+            $manager->exists()
+        );
+
+        $I->assertNull(
+            $manager->get('test')
+        );
+
+        $I->expectThrowable(
+            new Exception('The session has been opened in read only mode'),
+            function () use ($manager) {
+                $manager->set('test', 'myval');
+            }
+        );
+    }
+}
@@ -0,0 +1,128 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Url;
+
+use IntegrationTester;
+use Phalcon\Mvc\Router;
+use Phalcon\Url;
+
+class CompileRoutesCest
+{
+    /**
+     * Tests Phalcon\Url :: compileRoutes()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function urlCompileRoutes(IntegrationTester $I)
+    {
+        $I->wantToTest('Url - compileRoutes()');
+
+        $url      = new Url($this->getRouter());
+        $compiled = $url->compileRoutes();
+
+        $I->assertEquals(
+            ['adminProducts', 'blogPost'],
+            array_keys($compiled)
+        );
+
+        $I->assertEquals(
+            ['', 'year', '/', 'month', '/', 'title', ''],
+            $compiled['blogPost']
+        );
+
+        $url->setBaseUri('/');
+
+        $I->assertEquals(
+            '/admin/products/p/index',
+            $url->get(
+                [
+                    'for'        => 'adminProducts',
+                    'controller' => 'products',
+                    'action'     => 'index',
+                ]
+            )
+        );
+    }
+
+    /**
+     * Tests Phalcon\Url :: setCompiledRoutes()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function urlSetCompiledRoutes(IntegrationTester $I)
+    {
+        $I->wantToTest('Url - setCompiledRoutes()');
+
+        $compiled = (new Url($this->getRouter()))->compileRoutes();
+
+        /**
+         * No router is needed once the routes are compiled
+         */
+        $url = new Url();
+
+        $url
+            ->setBaseUri('/')
+            ->setCompiledRoutes($compiled)
+        ;
+
+        $I->assertEquals(
+            '/2010/10/some-title',
+            $url->get(
+                [
+                    'for'   => 'blogPost',
+                    'year'  => '2010',
+                    'month' => 10,
+                    'title' => 'some-title',
+                ]
+            )
+        );
+
+        $I->assertEquals(
+            '/2010//',
+            $url->get(
+                [
+                    'for'  => 'blogPost',
+                    'year' => '2010',
+                ]
+            )
+        );
+    }
+
+    private function getRouter(): Router
+    {
+        $router = new Router(false);
+
+        $router
+            ->add(
+                '/admin/:controller/p/:action',
+                [
+                    'controller' => 1,
+                    'action'     => 2,
+                ]
+            )
+            ->setName('adminProducts')
+        ;
+
+        $router
+            ->add('/{year}/{month}/{title}')
+            ->setName('blogPost')
+        ;
+
+        $router->add('/about');
+
+        return $router;
+    }
+}
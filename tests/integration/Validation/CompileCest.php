@@ -0,0 +1,178 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Validation;
+
+use IntegrationTester;
+use Phalcon\Messages\Message;
+use Phalcon\Messages\Messages;
+use Phalcon\Validation;
+use Phalcon\Validation\Validator\Alpha;
+use Phalcon\Validation\Validator\Email;
+use Phalcon\Validation\Validator\PresenceOf;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Validation :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function validationCompile(IntegrationTester $I)
+    {
+        $I->wantToTest('Validation - compile()');
+
+        $presenceOf = new PresenceOf(
+            [
+                'cancelOnFail' => true,
+            ]
+        );
+        $alpha      = new Alpha();
+        $email      = new Email(
+            [
+                'allowEmpty' => true,
+            ]
+        );
+
+        $validation = new Validation();
+
+        $validation
+            ->add('name', $presenceOf)
+            ->add('name', $alpha)
+            ->add('email', $email)
+            ->setFilters('name', 'trim')
+        ;
+
+        $validation->setLabels(
+            [
+                'name' => 'Name',
+            ]
+        );
+
+        $plan = $validation->compile();
+
+        $I->assertSame($plan, $validation->getPlan());
+        $I->assertSame(['name' => 'trim'], $plan['filters']);
+        $I->assertSame(['name' => 'Name'], $plan['labels']);
+        $I->assertCount(3, $plan['rules']);
+
+        $I->assertSame('name', $plan['rules'][0]['field']);
+        $I->assertSame($presenceOf, $plan['rules'][0]['validator']);
+        $I->assertSame(2, $plan['rules'][0]['next']);
+        $I->assertNull($plan['rules'][1]['next']);
+        $I->assertTrue($plan['rules'][2]['allowEmpty']);
+
+        /**
+         * cancelOnFail skips the Alpha validator, allowEmpty the Email one
+         */
+        $messages = $validation->validate(
+            [
+                'name'  => '  ',
+                'email' => '',
+            ]
+        );
+
+        $I->assertEquals(
+            new Messages(
+                [
+                    new Message(
+                        'Field Name is required',
+                        'name',
+                        PresenceOf::class,
+                        0
+                    ),
+                ]
+            ),
+            $messages
+        );
+
+        $messages = $validation->validate(
+            [
+                'name'  => ' John ',
+                'email' => 'john',
+            ]
+        );
+
+        $I->assertEquals(
+            new Messages(
+                [
+                    new Message(
+                        'Field email must be an email address',
+                        'email',
+                        Email::class,
+                        0
+                    ),
+                ]
+            ),
+            $messages
+        );
+
+        /**
+         * Adding a validator discards the plan
+         */
+        $validation->add('email', new PresenceOf());
+
+        $I->assertNull($validation->getPlan());
+
+        /**
+         * So do filters, labels and validators
+         */
+        $validation->compile();
+        $validation->setFilters('email', 'trim');
+
+        $I->assertNull($validation->getPlan());
+
+        $validation->compile();
+        $validation->setLabels(['email' => 'E-mail']);
+
+        $I->assertNull($validation->getPlan());
+
+        $validation->compile();
+        $validation->setValidators([]);
+
+        $I->assertNull($validation->getPlan());
+    }
+
+    /**
+     * Tests Phalcon\Validation :: setPlan()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function validationSetPlan(IntegrationTester $I)
+    {
+        $I->wantToTest('Validation - setPlan()');
+
+        $compiled = new Validation();
+
+        $compiled->add('name', new PresenceOf());
+
+        $plan = unserialize(
+            serialize(
+                $compiled->compile()
+            )
+        );
+
+        $validation = new Validation();
+
+        $validation->setPlan($plan);
+
+        $I->assertCount(1, $validation->getValidators()['name']);
+
+        $messages = $validation->validate([]);
+
+        $I->assertCount(1, $messages);
+        $I->assertEquals('Field name is required', $messages[0]->getMessage());
+    }
+}
@@ -0,0 +1,83 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Config\Snapshot;
+
+use Phalcon\Config\Adapter\Grouped;
+use Phalcon\Config\Snapshot;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Config\Snapshot :: compile()/load()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function configSnapshotCompile(UnitTester $I)
+    {
+        $I->wantToTest('Config\Snapshot - compile()/load()');
+
+        $grouped = new Grouped(
+            [
+                dataDir('assets/config/config.php'),
+                [
+                    'adapter' => 'array',
+                    'config'  => [
+                        'test' => [
+                            'parent' => [
+                                'property2' => 'something-else',
+                            ],
+                        ],
+                    ],
+                ],
+            ]
+        );
+
+        $file     = outputDir('config-snapshot.php');
+        $compiled = Snapshot::compile($grouped, $file);
+
+        $I->assertFileExists($file);
+
+        $snapshot = Snapshot::load($file);
+
+        $I->assertEquals($grouped->toArray(), $snapshot->toArray());
+        $I->assertEquals($compiled->toArray(), $snapshot->toArray());
+
+        $I->assertEquals(
+            'something-else',
+            $snapshot->path('test.parent.property2')
+        );
+
+        $I->assertEquals(
+            1,
+            $snapshot->path('test.parent.property')
+        );
+
+        $I->assertEquals(
+            'redis',
+            $snapshot->path('issue-12725.channel.handlers.1.name')
+        );
+
+        $I->assertEquals(
+            'something-else',
+            $snapshot->test->parent->property2
+        );
+
+        $I->safeDeleteFile($file);
+    }
+}
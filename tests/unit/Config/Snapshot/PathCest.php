@@ -0,0 +1,108 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Config\Snapshot;
+
+use Phalcon\Config;
+use Phalcon\Config\Exception;
+use Phalcon\Config\Snapshot;
+use UnitTester;
+
+class PathCest
+{
+    /**
+     * Tests Phalcon\Config\Snapshot :: path()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function configSnapshotPath(UnitTester $I)
+    {
+        $I->wantToTest('Config\Snapshot - path()');
+
+        $snapshot = new Snapshot(
+            [
+                'database' => [
+                    'host'    => 'localhost',
+                    'options' => null,
+                ],
+            ]
+        );
+
+        $database = $snapshot->path('database');
+
+        $I->assertInstanceOf(Snapshot::class, $database);
+        $I->assertInstanceOf(Config::class, $database);
+        $I->assertEquals(
+            [
+                'host'    => 'localhost',
+                'options' => null,
+            ],
+            $database->toArray()
+        );
+
+        $I->assertEquals('localhost', $snapshot->path('database.host'));
+        $I->assertEquals('localhost', $snapshot->path('Database.HOST'));
+        $I->assertEquals('localhost', $database->path('host'));
+        $I->assertNull($snapshot->path('database.options', 'default'));
+        $I->assertEquals('default', $snapshot->path('database.port', 'default'));
+
+        $I->assertTrue($snapshot->has('database'));
+        $I->assertTrue($snapshot->database->has('host'));
+        $I->assertFalse($snapshot->database->has('port'));
+
+        $I->assertEquals('localhost', $snapshot['database']['host']);
+        $I->assertEquals('localhost', $snapshot->database->host);
+        $I->assertSame($database, $snapshot->database);
+    }
+
+    /**
+     * Tests Phalcon\Config\Snapshot :: offsetSet() - read only
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function configSnapshotReadOnly(UnitTester $I)
+    {
+        $I->wantToTest('Config\Snapshot - offsetSet() - read only');
+
+        $I->expectThrowable(
+            new Exception('The configuration snapshot is read only'),
+            function () {
+                $snapshot = new Snapshot(['one' => 1]);
+
+                $snapshot['one'] = 2;
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Config\Snapshot :: __set() - read only nested section
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function configSnapshotReadOnlyNested(UnitTester $I)
+    {
+        $I->wantToTest('Config\Snapshot - __set() - read only nested section');
+
+        $I->expectThrowable(
+            new Exception('The configuration snapshot is read only'),
+            function () {
+                $snapshot = new Snapshot(['database' => ['host' => 'localhost']]);
+
+                $snapshot->database->host = 'remote';
+            }
+        );
+    }
+}
@@ -0,0 +1,144 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Crypt;
+
+use Phalcon\Crypt;
+use Phalcon\Crypt\Mismatch;
+use Phalcon\Http\Message\Stream\Temp;
+use UnitTester;
+
+use function pack;
+use function str_repeat;
+use function strlen;
+use function substr;
+
+class DecryptStreamCest
+{
+    /**
+     * Tests Phalcon\Crypt :: decryptStream() - forged chunk size
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptDecryptStreamForgedChunkSize(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - decryptStream() - forged chunk size');
+
+        $encrypted = $this->getEncrypted();
+        $encrypted = substr($encrypted, 0, 5) . pack('N', 0xFFFFFFFF) . substr($encrypted, 9);
+
+        $I->expectThrowable(
+            new Mismatch('Invalid chunk size in the encrypted stream'),
+            function () use ($encrypted) {
+                $this->decrypt($encrypted);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: decryptStream() - tampered
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptDecryptStreamTampered(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - decryptStream() - tampered');
+
+        $encrypted = $this->getEncrypted();
+        $position  = strlen($encrypted) - 20;
+
+        $encrypted[$position] = chr(ord($encrypted[$position]) ^ 1);
+
+        $I->expectThrowable(
+            new Mismatch('Hash does not match.'),
+            function () use ($encrypted) {
+                $this->decrypt($encrypted);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: decryptStream() - truncated
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptDecryptStreamTruncated(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - decryptStream() - truncated');
+
+        $encrypted = $this->getEncrypted();
+
+        /**
+         * Header (29) and the first full frame (5 + 16 + 16)
+         */
+        $encrypted = substr($encrypted, 0, 29 + 37);
+
+        $I->expectThrowable(
+            new Mismatch('Unexpected end of the encrypted stream'),
+            function () use ($encrypted) {
+                $this->decrypt($encrypted);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: decryptStream() - wrong key
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptDecryptStreamWrongKey(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - decryptStream() - wrong key');
+
+        $encrypted = $this->getEncrypted();
+
+        $I->expectThrowable(
+            new Mismatch('Hash does not match.'),
+            function () use ($encrypted) {
+                $this->decrypt($encrypted, 'another key');
+            }
+        );
+    }
+
+    private function decrypt(string $encrypted, string $key = null)
+    {
+        $crypt = new Crypt();
+        $crypt->setKey('le$ki12432543543543543');
+
+        $source = new Temp('w+b');
+        $source->write($encrypted);
+        $source->rewind();
+
+        $crypt->decryptStream($source, new Temp('w+b'), $key);
+    }
+
+    private function getEncrypted(): string
+    {
+        $crypt = new Crypt();
+        $crypt->setKey('le$ki12432543543543543');
+
+        $source = new Temp('w+b');
+        $source->write(str_repeat('Phalcon Framework ', 4));
+        $source->rewind();
+
+        $encrypted = new Temp('w+b');
+
+        $crypt->encryptStream($source, $encrypted, null, 16);
+
+        return (string) $encrypted;
+    }
+}
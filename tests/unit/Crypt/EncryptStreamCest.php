@@ -0,0 +1,133 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Crypt;
+
+use Codeception\Example;
+use Phalcon\Crypt;
+use Phalcon\Crypt\Exception;
+use Phalcon\Http\Message\Stream\Temp;
+use RuntimeException;
+use UnitTester;
+
+use function fclose;
+use function fopen;
+use function fwrite;
+use function rewind;
+use function str_repeat;
+use function stream_get_contents;
+
+class EncryptStreamCest
+{
+    /**
+     * Tests Phalcon\Crypt :: encryptStream()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptEncryptStream(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Crypt - encryptStream() - ' . $example[0]);
+
+        $crypt = new Crypt();
+        $crypt->setKey('le$ki12432543543543543');
+
+        $source = new Temp('w+b');
+        $source->write($example[1]);
+        $source->rewind();
+
+        $encrypted = new Temp('w+b');
+
+        $written = $crypt->encryptStream($source, $encrypted, null, 16);
+
+        $I->assertEquals($written, $encrypted->getSize());
+        $I->assertNotContains($example[1] ?: 'x', (string) $encrypted);
+
+        $encrypted->rewind();
+        $decrypted = new Temp('w+b');
+
+        $written = $crypt->decryptStream($encrypted, $decrypted);
+
+        $I->assertEquals(strlen($example[1]), $written);
+        $I->assertEquals($example[1], (string) $decrypted);
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: encryptStream() - empty key
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptEncryptStreamEmptyKey(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - encryptStream() - empty key');
+
+        $I->expectThrowable(
+            new Exception('Encryption key cannot be empty'),
+            function () {
+                $crypt = new Crypt();
+                $crypt->encryptStream(new Temp('w+b'), new Temp('w+b'));
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Crypt :: encryptStream() - caller resources are not
+     * closed on failure
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function cryptEncryptStreamFailureKeepsResources(UnitTester $I)
+    {
+        $I->wantToTest('Crypt - encryptStream() - failure keeps resources');
+
+        $crypt = new Crypt();
+        $crypt->setKey('le$ki12432543543543543');
+
+        $source = fopen('php://memory', 'w+b');
+        fwrite($source, 'The MIT License');
+        rewind($source);
+
+        /**
+         * Not writable: the header cannot be written
+         */
+        $destination = fopen('php://memory', 'rb');
+
+        $I->expectThrowable(
+            RuntimeException::class,
+            function () use ($crypt, $source, $destination) {
+                $crypt->encryptStream($source, $destination);
+            }
+        );
+
+        $I->assertInternalType('resource', $source);
+        $I->assertInternalType('resource', $destination);
+        $I->assertEquals('The MIT License', stream_get_contents($source, -1, 0));
+
+        fclose($source);
+        fclose($destination);
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            ['empty', ''],
+            ['one chunk', 'The MIT License'],
+            ['exact chunks', str_repeat('0123456789abcdef', 3)],
+            ['partial chunk', str_repeat('Phalcon Framework ', 7)],
+        ];
+    }
+}
@@ -41,4 +41,30 @@ class EscapeCssCest
             $escaper->escapeCss($source)
         );
     }
+
+    /**
+     * Tests Phalcon\Escaper :: escapeCss() - multibyte and non UTF-8
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function escaperEscapeCssMultibyte(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - escapeCss() - multibyte');
+
+        $escaper = new Escaper();
+
+        $I->assertEquals(
+            'a\20 \20ac \20 \1f600 \7f ',
+            $escaper->escapeCss("a \u{20ac} \u{1f600}\x7f")
+        );
+
+        /**
+         * ISO-8859-1
+         */
+        $I->assertEquals(
+            '\e9 t\e9 ',
+            $escaper->escapeCss("\xe9t\xe9")
+        );
+    }
 }
@@ -53,4 +53,30 @@ class EscapeJsCest
             $escaper->escapeJs($source)
         );
     }
+
+    /**
+     * Tests Phalcon\Escaper :: escapeJs() - multibyte and non UTF-8
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function escaperEscapeJsMultibyte(UnitTester $I)
+    {
+        $I->wantToTest('Escaper - escapeJs() - multibyte');
+
+        $escaper = new Escaper();
+
+        $I->assertEquals(
+            'price: \x20ac5 \x3c\x3e\x22\x27 \x1f600',
+            $escaper->escapeJs("price: \u{20ac}5 <>\"' \u{1f600}")
+        );
+
+        /**
+         * ISO-8859-1
+         */
+        $I->assertEquals(
+            '\xe9t\xe9',
+            $escaper->escapeJs("\xe9t\xe9")
+        );
+    }
 }
@@ -0,0 +1,129 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Filter\Filter;
+
+use Codeception\Example;
+use Phalcon\Filter\FilterFactory;
+use UnitTester;
+
+class SanitizeColumnCest
+{
+    /**
+     * Tests Phalcon\Filter :: sanitizeColumn() returns the same values as
+     * sanitize()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function filterFilterSanitizeColumn(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Filter - sanitizeColumn() - ' . $example[0]);
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $values = [
+            'a' => '  Hello World 12 ',
+            'b' => '<b>-13.5</b>',
+            'c' => 'ÉCOLE étÉ',
+            'd' => 'john(at)example.com',
+        ];
+
+        $expected = [];
+
+        foreach ($values as $key => $value) {
+            $expected[$key] = $filter->sanitize($value, $example[1]);
+        }
+
+        $I->assertSame(
+            $expected,
+            $filter->sanitizeColumn($values, $example[1])
+        );
+    }
+
+    /**
+     * Tests Phalcon\Filter :: sanitizeColumn() - custom sanitizer
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function filterFilterSanitizeColumnCustom(UnitTester $I)
+    {
+        $I->wantToTest('Filter - sanitizeColumn() - custom');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $filter->set(
+            'trim',
+            function ($input) {
+                return '[' . $input . ']';
+            }
+        );
+
+        $I->assertSame(
+            ['[a]', '[b]'],
+            $filter->sanitizeColumn(['a', 'b'], 'trim')
+        );
+
+        $I->assertSame(
+            ['xbc', 'dex'],
+            $filter->sanitizeColumn(
+                ['abc', 'dea'],
+                [
+                    'replace' => ['a', 'x'],
+                ]
+            )
+        );
+    }
+
+    /**
+     * Tests Phalcon\Filter :: sanitizeColumn() - values containing the
+     * separator used for case conversion
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function filterFilterSanitizeColumnNulByte(UnitTester $I)
+    {
+        $I->wantToTest('Filter - sanitizeColumn() - NUL byte');
+
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $I->assertSame(
+            ["A\0B", 'C'],
+            $filter->sanitizeColumn(["a\0b", 'c'], 'upper')
+        );
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            ['absint', 'absint'],
+            ['alnum', 'alnum'],
+            ['alpha', 'alpha'],
+            ['email', 'email'],
+            ['float', 'float'],
+            ['int', 'int'],
+            ['lower', 'lower'],
+            ['striptags', 'striptags'],
+            ['trim', 'trim'],
+            ['upper', 'upper'],
+            ['chain', ['striptags', 'trim', 'lower']],
+        ];
+    }
+}
@@ -0,0 +1,98 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Message\Stream;
+
+use Phalcon\Http\Message\Stream;
+use Phalcon\Http\Message\Stream\Temp;
+use RuntimeException;
+use UnitTester;
+
+use function file_get_contents;
+use function fopen;
+use function rewind;
+use function stream_get_contents;
+
+class CopyToCest
+{
+    /**
+     * Tests Phalcon\Http\Message\Stream :: copyTo()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamCopyTo(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - copyTo()');
+
+        $fileName    = dataDir('assets/stream/mit.txt');
+        $stream      = new Stream($fileName, 'rb');
+        $destination = new Temp('w+b');
+
+        $expected = file_get_contents($fileName);
+        $actual   = $stream->copyTo($destination);
+        $I->assertEquals(strlen($expected), $actual);
+
+        $destination->rewind();
+
+        $actual = $destination->getContents();
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream :: copyTo() - slice
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamCopyToSlice(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - copyTo() - slice');
+
+        $fileName    = dataDir('assets/stream/mit.txt');
+        $stream      = new Stream($fileName, 'rb');
+        $destination = fopen('php://memory', 'w+b');
+
+        $actual = $stream->copyTo($destination, 15, 0);
+        $I->assertEquals(15, $actual);
+
+        rewind($destination);
+
+        $expected = substr(file_get_contents($fileName), 0, 15);
+        $actual   = stream_get_contents($destination);
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream :: copyTo() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamCopyToException(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - copyTo() - exception');
+
+        $I->expectThrowable(
+            new RuntimeException(
+                'The destination is not a valid stream'
+            ),
+            function () {
+                $fileName = dataDir('assets/stream/mit.txt');
+                $stream   = new Stream($fileName, 'rb');
+
+                $stream->copyTo('unknown');
+            }
+        );
+    }
+}
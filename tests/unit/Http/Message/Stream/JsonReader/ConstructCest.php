@@ -0,0 +1,59 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Message\Stream\JsonReader;
+
+use Iterator;
+use Phalcon\Http\Message\Stream\JsonReader;
+use Phalcon\Http\Message\Stream\Temp;
+use RuntimeException;
+use UnitTester;
+
+class ConstructCest
+{
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: __construct()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderConstruct(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - __construct()');
+
+        $reader = new JsonReader(new Temp());
+
+        $I->assertInstanceOf(Iterator::class, $reader);
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: __construct() - unknown
+     * mode
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderConstructUnknownMode(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - __construct() - unknown mode');
+
+        $I->expectThrowable(
+            new RuntimeException(
+                'Unknown JSON stream mode'
+            ),
+            function () {
+                new JsonReader(new Temp(), 99);
+            }
+        );
+    }
+}
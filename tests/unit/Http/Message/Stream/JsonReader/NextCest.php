@@ -0,0 +1,169 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Message\Stream\JsonReader;
+
+use Codeception\Example;
+use Phalcon\Http\Message\Stream\JsonReader;
+use Phalcon\Http\Message\Stream\Temp;
+use RuntimeException;
+use UnitTester;
+
+class NextCest
+{
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: next()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderNext(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - next() - ' . $example[0]);
+
+        $stream = new Temp('w+b');
+        $stream->write($example[2]);
+        $stream->rewind();
+
+        /**
+         * Small chunks so that records span several reads
+         */
+        $reader = new JsonReader($stream, $example[1], true, 3);
+
+        $I->assertEquals(
+            $example[3],
+            iterator_to_array($reader)
+        );
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: next() - rewind
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderNextRewind(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - next() - rewind');
+
+        $stream = new Temp('w+b');
+        $stream->write("{\"id\":1}\n{\"id\":2}\n");
+        $stream->rewind();
+
+        $reader   = new JsonReader($stream);
+        $expected = [
+            (object) ['id' => 1],
+            (object) ['id' => 2],
+        ];
+
+        $I->assertEquals($expected, iterator_to_array($reader));
+        $I->assertEquals($expected, iterator_to_array($reader));
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: next() - not an array
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderNextNotArray(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - next() - not an array');
+
+        $I->expectThrowable(
+            new RuntimeException(
+                'The stream does not contain a JSON array'
+            ),
+            function () {
+                $stream = new Temp('w+b');
+                $stream->write('{"id":1}');
+                $stream->rewind();
+
+                $reader = new JsonReader($stream, JsonReader::MODE_ARRAY);
+
+                iterator_to_array($reader);
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream\JsonReader :: next() - truncated
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamJsonReaderNextTruncated(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\JsonReader - next() - truncated');
+
+        $I->expectThrowable(
+            new RuntimeException(
+                'Unexpected end of the JSON array in the stream'
+            ),
+            function () {
+                $stream = new Temp('w+b');
+                $stream->write('[{"id":1},{"id":');
+                $stream->rewind();
+
+                $reader = new JsonReader($stream, JsonReader::MODE_ARRAY);
+
+                iterator_to_array($reader);
+            }
+        );
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            [
+                'ndjson',
+                JsonReader::MODE_NDJSON,
+                "{\"id\":1}\n\n{\"id\":2,\"name\":\"a\\nb\"}\r\n[3]",
+                [
+                    ['id' => 1],
+                    ['id' => 2, 'name' => "a\nb"],
+                    [3],
+                ],
+            ],
+            [
+                'ndjson empty',
+                JsonReader::MODE_NDJSON,
+                "\n\n",
+                [],
+            ],
+            [
+                'array of objects',
+                JsonReader::MODE_ARRAY,
+                ' [ {"id":1,"tags":["a","]"]} , {"id":2,"name":"x\\"}y"} ] ',
+                [
+                    ['id' => 1, 'tags' => ['a', ']']],
+                    ['id' => 2, 'name' => 'x"}y'],
+                ],
+            ],
+            [
+                'array of scalars',
+                JsonReader::MODE_ARRAY,
+                '[1, "two", true, null, 4.5]',
+                [1, 'two', true, null, 4.5],
+            ],
+            [
+                'empty array',
+                JsonReader::MODE_ARRAY,
+                '[ ]',
+                [],
+            ],
+        ];
+    }
+}
@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Message\Stream;
+
+use Phalcon\Http\Message\Stream;
+use Phalcon\Http\Message\Stream\Temp;
+use RuntimeException;
+use UnitTester;
+
+use function file_get_contents;
+use function ob_get_clean;
+use function ob_start;
+
+class OutputCest
+{
+    /**
+     * Tests Phalcon\Http\Message\Stream :: output()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamOutput(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - output()');
+
+        $fileName = dataDir('assets/stream/mit.txt');
+        $stream   = new Stream($fileName, 'rb');
+
+        ob_start();
+        $bytes  = $stream->output();
+        $actual = ob_get_clean();
+
+        $expected = file_get_contents($fileName);
+        $I->assertEquals($expected, $actual);
+        $I->assertEquals(strlen($expected), $bytes);
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream :: output() - chunks
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamOutputChunks(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - output() - chunks');
+
+        $stream = new Temp('w+b', 16);
+        $stream->write('The MIT License (MIT) - Copyright (c) Phalcon Team');
+        $stream->rewind();
+
+        ob_start();
+        $bytes  = $stream->output(7);
+        $actual = ob_get_clean();
+
+        $expected = 'The MIT License (MIT) - Copyright (c) Phalcon Team';
+        $I->assertEquals($expected, $actual);
+        $I->assertEquals(strlen($expected), $bytes);
+    }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream :: output() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamOutputException(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream - output() - exception');
+
+        $I->expectThrowable(
+            new RuntimeException(
+                'The chunk size must be greater than zero'
+            ),
+            function () {
+                $fileName = dataDir('assets/stream/mit.txt');
+                $stream   = new Stream($fileName, 'rb');
+
+                $stream->output(0);
+            }
+        );
+    }
+}
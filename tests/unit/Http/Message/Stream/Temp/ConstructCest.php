@@ -32,4 +32,28 @@ class ConstructCest
         $class   = StreamInterface::class;
         $I->assertInstanceOf($class, $request);
     }
+
+    /**
+     * Tests Phalcon\Http\Message\Stream\Temp :: __construct() - max memory
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpMessageStreamTempConstructMaxMemory(UnitTester $I)
+    {
+        $I->wantToTest('Http\Message\Stream\Temp - __construct() - max memory');
+
+        $stream = new Temp('w+b', 1024);
+
+        $expected = 'php://temp/maxmemory:1024';
+        $actual   = $stream->getMetadata('uri');
+        $I->assertEquals($expected, $actual);
+
+        $stream->write(str_repeat('a', 4096));
+        $stream->rewind();
+
+        $expected = 4096;
+        $actual   = strlen($stream->getContents());
+        $I->assertEquals($expected, $actual);
+    }
 }
@@ -0,0 +1,175 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Response;
+
+use Phalcon\Http\Message\Stream;
+use Phalcon\Test\Unit\Http\Helper\HttpBase;
+use Psr\Http\Message\StreamInterface;
+use UnitTester;
+
+class SetContentStreamCest extends HttpBase
+{
+    /**
+     * Tests Phalcon\Http\Response :: setContentStream()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpResponseSetContentStream(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - setContentStream()');
+
+        $fileName = dataDir('assets/stream/mit.txt');
+        $response = $this->getResponseObject();
+
+        $response->setContentStream(
+            new Stream($fileName, 'rb'),
+            64
+        );
+
+        ob_start();
+        $response->send();
+        $actual = ob_get_clean();
+
+        $expected = file_get_contents($fileName);
+        $I->assertEquals($expected, $actual);
+
+        $I->assertTrue(
+            $response->isSent()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Http\Response :: setContentStream() - content first
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpResponseSetContentStreamContentFirst(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - setContentStream() - content first');
+
+        $response = $this->getResponseObject();
+
+        $response
+            ->setContentStream(
+                new Stream(dataDir('assets/stream/mit.txt'), 'rb')
+            )
+            ->setContent('<h1>Hello</h1>')
+        ;
+
+        ob_start();
+        $response->send();
+        $actual = ob_get_clean();
+
+        $I->assertEquals('<h1>Hello</h1>', $actual);
+    }
+
+    /**
+     * Tests Phalcon\Http\Response :: setContentStream() - empty read
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function httpResponseSetContentStreamEmptyRead(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - setContentStream() - empty read');
+
+        /**
+         * A slow source: nothing to read yet, and not at the end either
+         */
+        $stream = new class implements StreamInterface {
+            public function __toString()
+            {
+                return '';
+            }
+
+            public function close()
+            {
+            }
+
+            public function detach()
+            {
+                return null;
+            }
+
+            public function getSize()
+            {
+                return null;
+            }
+
+            public function tell()
+            {
+                return 0;
+            }
+
+            public function eof()
+            {
+                return false;
+            }
+
+            public function isSeekable()
+            {
+                return false;
+            }
+
+            public function seek($offset, $whence = SEEK_SET)
+            {
+            }
+
+            public function rewind()
+            {
+            }
+
+            public function isWritable()
+            {
+                return false;
+            }
+
+            public function write($string)
+            {
+                return 0;
+            }
+
+            public function isReadable()
+            {
+                return true;
+            }
+
+            public function read($length)
+            {
+                return '';
+            }
+
+            public function getContents()
+            {
+                return '';
+            }
+
+            public function getMetadata($key = null)
+            {
+                return null;
+            }
+        };
+
+        $response = $this->getResponseObject();
+        $response->setContentStream($stream);
+
+        ob_start();
+        $response->send();
+        $actual = ob_get_clean();
+
+        $I->assertEquals('', $actual);
+    }
+}
@@ -14,6 +14,7 @@ declare(strict_types=1);
 namespace Phalcon\Test\Unit\Image\Adapter\Gd;
 
 use Phalcon\Image\Adapter\Gd;
+use Phalcon\Image\Enum;
 use Phalcon\Test\Fixtures\Traits\GdTrait;
 use UnitTester;
 
@@ -40,4 +41,56 @@ class ConstructCest
             );
         }
     }
+
+    /**
+     * Tests Phalcon\Image\Adapter\Gd :: __construct() - deferred
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageAdapterGdConstructDeferred(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Gd - __construct() - deferred');
+
+        $outputDir = 'tests/image/gd';
+        $output    = outputDir($outputDir . '/deferred.jpg');
+
+        $image = new Gd(
+            dataDir('assets/images/phalconphp.jpg'),
+            null,
+            null,
+            true
+        );
+
+        $I->assertSame(1820, $image->getWidth());
+        $I->assertSame(694, $image->getHeight());
+
+        $image
+            ->resize(400, 400, Enum::INVERSE)
+            ->crop(400, 400);
+
+        /**
+         * Recorded operations already report the final size
+         */
+        $I->assertSame(400, $image->getWidth());
+        $I->assertSame(400, $image->getHeight());
+
+        $image->save($output);
+
+        $I->amInPath(
+            outputDir($outputDir)
+        );
+
+        $I->seeFileFound('deferred.jpg');
+
+        $size = getimagesize($output);
+
+        $I->assertSame(400, $size[0]);
+        $I->assertSame(400, $size[1]);
+
+        $I->assertSame(400, imagesx($image->getImage()));
+        $I->assertSame(400, imagesy($image->getImage()));
+
+        $I->safeDeleteFile('deferred.jpg');
+    }
 }
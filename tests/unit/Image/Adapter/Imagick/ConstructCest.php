@@ -0,0 +1,69 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Image\Adapter\Imagick;
+
+use Phalcon\Image\Adapter\Imagick;
+use Phalcon\Image\Enum;
+use Phalcon\Test\Fixtures\Traits\ImagickTrait;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+
+class ConstructCest
+{
+    use ImagickTrait;
+
+    /**
+     * Tests Phalcon\Image\Adapter\Imagick :: __construct() - deferred
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageAdapterImagickConstructDeferred(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Imagick - __construct() - deferred');
+
+        $image = new Imagick(
+            dataDir('assets/images/phalconphp.jpg'),
+            null,
+            null,
+            true
+        );
+
+        $I->assertEquals(1820, $image->getWidth());
+        $I->assertEquals(694, $image->getHeight());
+
+        $image
+            ->resize(200, 200, Enum::INVERSE)
+            ->crop(200, 200)
+            ->save(outputDir('tests/image/imagick/deferred.jpg'));
+
+        $I->amInPath(
+            outputDir('tests/image/imagick/')
+        );
+
+        $I->seeFileFound('deferred.jpg');
+
+        $I->assertEquals(200, $image->getWidth());
+        $I->assertEquals(200, $image->getHeight());
+
+        $internal = $image->getInternalImInstance();
+
+        $I->assertEquals(200, $internal->getImageWidth());
+        $I->assertEquals(200, $internal->getImageHeight());
+
+        $I->safeDeleteFile('deferred.jpg');
+    }
+}
@@ -0,0 +1,58 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Image\Adapter\Imagick;
+
+use Phalcon\Image\Adapter\Imagick;
+use UnitTester;
+
+use function dataDir;
+
+class DecodeCest
+{
+    /**
+     * Tests Phalcon\Image\Adapter\Imagick :: decode()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageAdapterImagickDecode(UnitTester $I)
+    {
+        $I->wantToTest('Image\Adapter\Imagick - decode()');
+
+        $I->checkExtensionIsLoaded('imagick');
+
+        $image = new Imagick(
+            dataDir('assets/images/phalconphp.jpg'),
+            null,
+            null,
+            true
+        );
+
+        $I->assertEquals(1820, $image->getWidth());
+        $I->assertEquals(694, $image->getHeight());
+
+        $image->decode(455, 174);
+
+        /**
+         * Decoded by libjpeg at a reduced scale, covering the size given
+         */
+        $I->assertGreaterThanOrEqual(455, $image->getWidth());
+        $I->assertGreaterThanOrEqual(174, $image->getHeight());
+        $I->assertLessThan(1820, $image->getWidth());
+        $I->assertEquals(
+            $image->getWidth(),
+            $image->getImage()->getImageWidth()
+        );
+    }
+}
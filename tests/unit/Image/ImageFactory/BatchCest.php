@@ -0,0 +1,165 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Image\ImageFactory;
+
+use Codeception\Example;
+use Phalcon\Image\Exception;
+use Phalcon\Image\ImageFactory;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+
+class BatchCest
+{
+    /**
+     * Tests Phalcon\Image\ImageFactory :: batch()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageImageFactoryBatch(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Image\ImageFactory - batch() - ' . $example['adapter']);
+
+        $I->checkExtensionIsLoaded($example['extension']);
+
+        $factory = new ImageFactory();
+        $large   = outputDir('tests/image/batch-large.jpg');
+        $square  = outputDir('tests/image/batch-square.png');
+
+        $result = $factory->batch(
+            $example['adapter'],
+            dataDir('assets/images/phalconphp.jpg'),
+            [
+                'large'  => [
+                    'file'    => $large,
+                    'width'   => 600,
+                    'height'  => 600,
+                    'quality' => 80,
+                ],
+                'square' => [
+                    'file'   => $square,
+                    'width'  => 100,
+                    'height' => 100,
+                    'crop'   => true,
+                    'format' => 'png',
+                ],
+            ]
+        );
+
+        $I->assertSame(
+            ['source', 'large', 'square'],
+            array_keys($result)
+        );
+
+        $I->assertEquals(600, $result['large']['width']);
+        $I->assertEquals(229, $result['large']['height']);
+        $I->assertEquals(100, $result['square']['width']);
+        $I->assertEquals(100, $result['square']['height']);
+        $I->assertGreaterThanOrEqual(0, $result['square']['time']);
+
+        $size = getimagesize($large);
+
+        $I->assertEquals(600, $size[0]);
+        $I->assertEquals(229, $size[1]);
+        $I->assertEquals(IMAGETYPE_JPEG, $size[2]);
+
+        $size = getimagesize($square);
+
+        $I->assertEquals(100, $size[0]);
+        $I->assertEquals(100, $size[1]);
+        $I->assertEquals(IMAGETYPE_PNG, $size[2]);
+
+        $I->safeDeleteFile($large);
+        $I->safeDeleteFile($square);
+    }
+
+    /**
+     * Tests Phalcon\Image\ImageFactory :: batch() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageImageFactoryBatchException(UnitTester $I)
+    {
+        $I->wantToTest('Image\ImageFactory - batch() - exception');
+
+        $I->expectThrowable(
+            new Exception(
+                "You must provide 'file' option for the variant 'large'"
+            ),
+            function () {
+                $factory = new ImageFactory();
+
+                $factory->batch(
+                    'gd',
+                    dataDir('assets/images/phalconphp.jpg'),
+                    [
+                        'large' => [
+                            'width' => 600,
+                        ],
+                    ]
+                );
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Image\ImageFactory :: batch() - reserved variant name
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function imageImageFactoryBatchSourceName(UnitTester $I)
+    {
+        $I->wantToTest('Image\ImageFactory - batch() - reserved variant name');
+
+        $I->expectThrowable(
+            new Exception(
+                "The variant name 'source' is reserved for the source image"
+            ),
+            function () {
+                $factory = new ImageFactory();
+
+                $factory->batch(
+                    'gd',
+                    dataDir('assets/images/phalconphp.jpg'),
+                    [
+                        'source' => [
+                            'file'  => outputDir('tests/image/batch-source.jpg'),
+                            'width' => 600,
+                        ],
+                    ]
+                );
+            }
+        );
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            [
+                'adapter'   => 'gd',
+                'extension' => 'gd',
+            ],
+            [
+                'adapter'   => 'imagick',
+                'extension' => 'imagick',
+            ],
+        ];
+    }
+}
@@ -0,0 +1,104 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Loader;
+
+use Phalcon\Loader;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+
+class DumpClassMapCest
+{
+    /**
+     * Tests Phalcon\Loader :: dumpClassMap()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function loaderDumpClassMap(UnitTester $I)
+    {
+        $I->wantToTest('Loader - dumpClassMap()');
+
+        $loader = new Loader();
+
+        $loader->registerNamespaces(
+            [
+                'Example\Namespaces\Adapter' => dataDir('fixtures/Loader/Example/Namespaces/Adapter/'),
+            ]
+        );
+
+        $loader->registerClasses(
+            [
+                'Example\Namespaces\Adapter\Mongo' => '/custom/Mongo.php',
+            ]
+        );
+
+        $expected = [
+            'Example\Namespaces\Adapter\Mongo'     => '/custom/Mongo.php',
+            'Example\Namespaces\Adapter\Blackhole' => dataDir('fixtures/Loader/Example/Namespaces/Adapter/Blackhole.php'),
+            'Example\Namespaces\Adapter\Memcached' => dataDir('fixtures/Loader/Example/Namespaces/Adapter/Memcached.php'),
+            'Example\Namespaces\Adapter\Redis'     => dataDir('fixtures/Loader/Example/Namespaces/Adapter/Redis.php'),
+        ];
+
+        $file   = outputDir('classmap.php');
+        $actual = $loader->dumpClassMap($file);
+
+        ksort($expected);
+        ksort($actual);
+
+        $I->assertEquals($expected, $actual);
+
+        $actual = require $file;
+
+        ksort($actual);
+
+        $I->assertEquals($expected, $actual);
+
+        $I->safeDeleteFile($file);
+    }
+
+    /**
+     * Tests Phalcon\Loader :: dumpClassMap() - extensions
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function loaderDumpClassMapExtensions(UnitTester $I)
+    {
+        $I->wantToTest('Loader - dumpClassMap() - extensions');
+
+        $loader = new Loader();
+
+        $loader->setExtensions(['inc', 'php']);
+
+        $loader->registerNamespaces(
+            [
+                'Example\Namespaces\Engines' => dataDir('fixtures/Loader/Example/Namespaces/Engines/'),
+            ]
+        );
+
+        $actual = $loader->dumpClassMap();
+
+        $I->assertEquals(
+            dataDir('fixtures/Loader/Example/Namespaces/Engines/Alcohol.inc'),
+            $actual['Example\Namespaces\Engines\Alcohol']
+        );
+
+        $I->assertEquals(
+            dataDir('fixtures/Loader/Example/Namespaces/Engines/Diesel.php'),
+            $actual['Example\Namespaces\Engines\Diesel']
+        );
+    }
+}
@@ -0,0 +1,81 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Loader;
+
+use Example\ClassMap\Mapped;
+use Phalcon\Loader;
+use UnitTester;
+
+use function class_exists;
+use function dataDir;
+use function outputDir;
+
+class LoadClassMapCest
+{
+    /**
+     * Tests Phalcon\Loader :: loadClassMap() - authoritative
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function loaderLoadClassMapAuthoritative(UnitTester $I)
+    {
+        $I->wantToTest('Loader - loadClassMap() - authoritative');
+
+        $file = outputDir('classmap.php');
+
+        file_put_contents(
+            $file,
+            "<?php\n\nreturn " . var_export(
+                [
+                    Mapped::class => dataDir('fixtures/Loader/Example/ClassMap/Mapped.php'),
+                ],
+                true
+            ) . ";\n"
+        );
+
+        $loader = new Loader();
+
+        $loader->registerNamespaces(
+            [
+                'Example\ClassMap' => dataDir('fixtures/Loader/Example/ClassMap/'),
+            ]
+        );
+
+        $loader->loadClassMap($file, true);
+        $loader->register();
+
+        $I->assertInstanceOf(
+            Mapped::class,
+            new Mapped()
+        );
+
+        /**
+         * Not in the class map - the namespaces are not consulted
+         */
+        $I->assertFalse(
+            class_exists('Example\ClassMap\NotMapped')
+        );
+
+        $loader->setAuthoritative(false);
+
+        $I->assertTrue(
+            class_exists('Example\ClassMap\NotMapped')
+        );
+
+        $loader->unregister();
+
+        $I->safeDeleteFile($file);
+    }
+}
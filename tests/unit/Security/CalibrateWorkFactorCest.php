@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security;
+
+use Phalcon\Security;
+use UnitTester;
+
+class CalibrateWorkFactorCest
+{
+    /**
+     * Tests Phalcon\Security :: calibrateWorkFactor()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityCalibrateWorkFactor(UnitTester $I)
+    {
+        $I->wantToTest('Security - calibrateWorkFactor()');
+
+        $security = new Security();
+
+        $I->assertEquals(
+            4,
+            $security->calibrateWorkFactor(0)
+        );
+
+        $actual = $security->calibrateWorkFactor(20, 8);
+
+        $I->assertGreaterOrEquals(4, $actual);
+        $I->assertLessOrEquals(8, $actual);
+    }
+}
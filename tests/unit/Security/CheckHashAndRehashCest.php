@@ -0,0 +1,59 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security;
+
+use Phalcon\Security;
+use UnitTester;
+
+class CheckHashAndRehashCest
+{
+    /**
+     * Tests Phalcon\Security :: checkHashAndRehash()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityCheckHashAndRehash(UnitTester $I)
+    {
+        $I->wantToTest('Security - checkHashAndRehash()');
+
+        $security = new Security();
+        $security->setWorkFactor(4);
+
+        $hash    = $security->hash('Phalcon');
+        $newHash = null;
+        $update  = function (string $hash) use (&$newHash) {
+            $newHash = $hash;
+        };
+
+        $I->assertFalse(
+            $security->checkHashAndRehash('Zephir', $hash, $update)
+        );
+
+        $I->assertTrue(
+            $security->checkHashAndRehash('Phalcon', $hash, $update)
+        );
+        $I->assertNull($newHash);
+
+        $security->setWorkFactor(5);
+
+        $I->assertTrue(
+            $security->checkHashAndRehash('Phalcon', $hash, $update)
+        );
+        $I->assertStringStartsWith('$2y$05$', $newHash);
+        $I->assertTrue(
+            $security->checkHash('Phalcon', $newHash)
+        );
+    }
+}
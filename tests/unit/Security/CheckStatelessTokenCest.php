@@ -0,0 +1,116 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security;
+
+use Phalcon\Security;
+use Phalcon\Security\Exception;
+use UnitTester;
+
+use function explode;
+use function time;
+
+class CheckStatelessTokenCest
+{
+    /**
+     * Tests Phalcon\Security :: checkStatelessToken()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityCheckStatelessToken(UnitTester $I)
+    {
+        $I->wantToTest('Security - checkStatelessToken()');
+
+        $security = new Security();
+        $security->setTokenSecret('phalcon-secret');
+
+        $token = $security->getStatelessToken('session-one');
+
+        $I->assertTrue(
+            $security->checkStatelessToken($token, 'session-one')
+        );
+
+        /**
+         * Bound to the session
+         */
+        $I->assertFalse(
+            $security->checkStatelessToken($token, 'session-two')
+        );
+
+        /**
+         * Different secret
+         */
+        $security->setTokenSecret('another-secret');
+
+        $I->assertFalse(
+            $security->checkStatelessToken($token, 'session-one')
+        );
+
+        $I->assertFalse(
+            $security->checkStatelessToken('garbage', 'session-one')
+        );
+    }
+
+    /**
+     * Tests Phalcon\Security :: checkStatelessToken() - expired
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityCheckStatelessTokenExpired(UnitTester $I)
+    {
+        $I->wantToTest('Security - checkStatelessToken() - expired');
+
+        $security = new Security();
+        $security->setTokenSecret('phalcon-secret');
+
+        $token = $security->getStatelessToken('session-one');
+        $parts = explode('.', $token);
+
+        /**
+         * Move the timestamp back - the signature no longer matches
+         */
+        $parts[0] = (string) (time() - 10);
+
+        $I->assertFalse(
+            $security->checkStatelessToken(implode('.', $parts), 'session-one')
+        );
+
+        $security->setTokenLifetime(-1);
+
+        $I->assertFalse(
+            $security->checkStatelessToken($token, 'session-one')
+        );
+    }
+
+    /**
+     * Tests Phalcon\Security :: getStatelessToken() - no secret
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityGetStatelessTokenNoSecret(UnitTester $I)
+    {
+        $I->wantToTest('Security - getStatelessToken() - no secret');
+
+        $I->expectThrowable(
+            new Exception('A secret is required to use stateless CSRF tokens'),
+            function () {
+                $security = new Security();
+
+                $security->getStatelessToken('session-one');
+            }
+        );
+    }
+}
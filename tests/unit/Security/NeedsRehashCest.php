@@ -0,0 +1,58 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security;
+
+use Phalcon\Security;
+use UnitTester;
+
+class NeedsRehashCest
+{
+    /**
+     * Tests Phalcon\Security :: needsRehash()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function securityNeedsRehash(UnitTester $I)
+    {
+        $I->wantToTest('Security - needsRehash()');
+
+        $security = new Security();
+        $security->setWorkFactor(5);
+
+        $hash = $security->hash('Phalcon');
+
+        $I->assertFalse(
+            $security->needsRehash($hash)
+        );
+
+        $security->setWorkFactor(6);
+
+        $I->assertTrue(
+            $security->needsRehash($hash)
+        );
+
+        $security->setDefaultHash(Security::CRYPT_SHA512);
+
+        $I->assertTrue(
+            $security->needsRehash($hash)
+        );
+
+        $I->assertFalse(
+            $security->needsRehash(
+                $security->hash('Phalcon')
+            )
+        );
+    }
+}
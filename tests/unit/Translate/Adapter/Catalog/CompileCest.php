@@ -0,0 +1,127 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Translate\Adapter\Catalog;
+
+use Phalcon\Test\Fixtures\Traits\TranslateCsvTrait;
+use Phalcon\Translate\Adapter\Catalog;
+use Phalcon\Translate\Adapter\Csv;
+use Phalcon\Translate\Exception;
+use Phalcon\Translate\InterpolatorFactory;
+use UnitTester;
+
+use function outputDir;
+
+class CompileCest
+{
+    use TranslateCsvTrait;
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Catalog :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterCatalogCompile(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Catalog - compile()');
+
+        $interpolator = new InterpolatorFactory();
+        $fileName     = outputDir('translation-catalog.php');
+        $csv          = new Csv($interpolator, $this->getCsvConfig()['en']);
+
+        $compiled = Catalog::compile($csv, $fileName);
+
+        $I->assertFileExists($fileName);
+
+        $expected = $csv->toArray();
+        $I->assertEquals($expected, $compiled['messages']);
+
+        $expected = [
+            'hello-key' => ['Hello ', 'name', ''],
+            'song-key'  => ['This song is ', 'song', ' (', 'artist', ')'],
+        ];
+        $I->assertEquals($expected, $compiled['templates']);
+
+        $translator = new Catalog(
+            $interpolator,
+            [
+                'content' => $fileName,
+            ]
+        );
+
+        $I->assertEquals($csv->toArray(), $translator->toArray());
+
+        $I->safeDeleteFile($fileName);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Catalog :: compile() - percent sign
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterCatalogCompilePercent(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Catalog - compile() - percent sign');
+
+        $fileName = outputDir('translation-catalog.php');
+        $compiled = Catalog::compile(
+            [
+                'discount' => '50% off for %name%',
+                'spaces'   => 'Hello %first name%',
+            ],
+            $fileName
+        );
+
+        $I->assertEquals([], $compiled['templates']);
+
+        $translator = new Catalog(
+            new InterpolatorFactory(),
+            [
+                'content' => $compiled,
+            ]
+        );
+
+        $expected = '50% off for Phalcon';
+        $actual   = $translator->query('discount', ['name' => 'Phalcon']);
+        $I->assertEquals($expected, $actual);
+
+        $expected = 'Hello Phalcon';
+        $actual   = $translator->query('spaces', ['first name' => 'Phalcon']);
+        $I->assertEquals($expected, $actual);
+
+        $I->safeDeleteFile($fileName);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Catalog :: compile() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterCatalogCompileException(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Catalog - compile() - exception');
+
+        $I->expectThrowable(
+            new Exception('Invalid source for the translation catalog'),
+            function () {
+                Catalog::compile(
+                    'unknown',
+                    outputDir('translation-catalog.php')
+                );
+            }
+        );
+    }
+}
@@ -0,0 +1,129 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Translate\Adapter\Catalog;
+
+use Codeception\Example;
+use Phalcon\Translate\Adapter\Catalog;
+use Phalcon\Translate\Exception;
+use Phalcon\Translate\InterpolatorFactory;
+use UnitTester;
+
+use function outputDir;
+
+class QueryCest
+{
+    /**
+     * Tests Phalcon\Translate\Adapter\Catalog :: query()
+     *
+     * @dataProvider getExamples
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterCatalogQuery(UnitTester $I, Example $example)
+    {
+        $I->wantToTest('Translate\Adapter\Catalog - query() - ' . $example['label']);
+
+        $fileName = outputDir('translation-catalog.php');
+
+        Catalog::compile(
+            [
+                'hi'        => 'Hello',
+                'hello-key' => 'Hello %name%',
+                'song-key'  => 'This song is %song% (%artist%)',
+            ],
+            $fileName
+        );
+
+        $translator = new Catalog(
+            new InterpolatorFactory(),
+            [
+                'content' => $fileName,
+            ]
+        );
+
+        $actual = $translator->query($example['key'], $example['placeholders']);
+        $I->assertEquals($example['expected'], $actual);
+
+        $I->safeDeleteFile($fileName);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Catalog :: query() - triggerError
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterCatalogQueryTriggerError(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Catalog - query() - triggerError');
+
+        $I->expectThrowable(
+            new Exception('Cannot find translation key: unknown'),
+            function () {
+                $translator = new Catalog(
+                    new InterpolatorFactory(),
+                    [
+                        'content'      => [
+                            'messages'  => ['hi' => 'Hello'],
+                            'templates' => [],
+                        ],
+                        'triggerError' => true,
+                    ]
+                );
+
+                $translator->query('unknown');
+            }
+        );
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            [
+                'label'        => 'plain',
+                'key'          => 'hi',
+                'placeholders' => [],
+                'expected'     => 'Hello',
+            ],
+            [
+                'label'        => 'placeholder',
+                'key'          => 'hello-key',
+                'placeholders' => ['name' => 'my friend'],
+                'expected'     => 'Hello my friend',
+            ],
+            [
+                'label'        => 'placeholders',
+                'key'          => 'song-key',
+                'placeholders' => [
+                    'song'   => 'Dust in the wind',
+                    'artist' => 'Kansas',
+                ],
+                'expected'     => 'This song is Dust in the wind (Kansas)',
+            ],
+            [
+                'label'        => 'missing placeholder',
+                'key'          => 'song-key',
+                'placeholders' => ['song' => 'Dust in the wind'],
+                'expected'     => 'This song is Dust in the wind (%artist%)',
+            ],
+            [
+                'label'        => 'unknown key',
+                'key'          => 'Hi %name%',
+                'placeholders' => ['name' => 'Phalcon'],
+                'expected'     => 'Hi Phalcon',
+            ],
+        ];
+    }
+}
@@ -0,0 +1,82 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Translate\Adapter\Gettext;
+
+use Phalcon\Test\Fixtures\Traits\TranslateGettextTrait;
+use Phalcon\Translate\Adapter\Gettext;
+use Phalcon\Translate\InterpolatorFactory;
+use UnitTester;
+
+class ToArrayCest
+{
+    use TranslateGettextTrait;
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Gettext :: toArray()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterGettextToArray(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Gettext - toArray()');
+
+        $translator = new Gettext(
+            new InterpolatorFactory(),
+            $this->getGettextConfig()
+        );
+
+        $expected = [
+            'hello-key' => 'Hello %name%',
+            'hi'        => 'Hello',
+            'song-key'  => 'The song is %song% (%artist%)',
+        ];
+        $actual   = $translator->toArray();
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Translate\Adapter\Gettext :: toArray() - locale fallback
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2020-01-20
+     */
+    public function translateAdapterGettextToArrayLocaleFallback(UnitTester $I)
+    {
+        $I->wantToTest('Translate\Adapter\Gettext - toArray() - locale fallback');
+
+        $translator = new Gettext(
+            new InterpolatorFactory(),
+            $this->getGettextConfig()
+        );
+
+        /**
+         * The codeset is normalized: en_US.UTF-8 is read from en_US.utf8
+         */
+        $translator->setLocale(LC_MESSAGES, 'en_US.UTF-8');
+
+        $I->assertEquals('Hello', $translator->toArray()['hi']);
+
+        /**
+         * A locale that is not installed (setlocale() returns false) still
+         * finds its catalog
+         */
+        $translator->setLocale(LC_MESSAGES, 'es_ES.UTF-8@phalcon');
+
+        $I->assertFalse($translator->getLocale());
+        $I->assertEquals('Hola', $translator->toArray()['hi']);
+
+        $translator->setLocale(LC_ALL, 'en_US.utf8');
+    }
+}